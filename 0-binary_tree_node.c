@@ -12,14 +12,33 @@
  * Description: This function creates a new binary tree node
  * with the given value
  *              and sets its parent, left, and right pointers to NULL.
+ *              The balancing data starts at 0.
  */
 binary_tree_t *binary_tree_node(binary_tree_t *parent, int value)
 {
-	binary_tree_t *new_node;
-	size_t node_size;
+	return (binary_tree_node_size(parent, value, sizeof(binary_tree_t)));
+}
 
-	/* Get the size of the new node */
-	node_size = sizeof(binary_tree_t);
+/**
+ * binary_tree_node_size - Creates a binary tree node embedded at the
+ * start of a larger structure.
+ *
+ * @parent: A pointer to the parent of the node to create.
+ * @value: The value to put in the new node.
+ * @node_size: The size of the structure to allocate, at least
+ * sizeof(binary_tree_t).
+ *
+ * Return: If successful, a pointer to the newly created node, whose
+ *         extra fields are left for the caller to set. Otherwise, NULL.
+ *
+ * Description: Augmented nodes (multiset, aggregate, interval...) embed
+ * a binary_tree_t as their first member, so they can be handled, printed
+ * and freed as plain nodes.
+ */
+binary_tree_t *binary_tree_node_size(binary_tree_t *parent, int value,
+		size_t node_size)
+{
+	binary_tree_t *new_node;
 
 	/* Dynamically allocate memory for the new node */
 	new_node = malloc(node_size);
@@ -28,6 +47,7 @@ binary_tree_t *binary_tree_node(binary_tree_t *parent, int value)
 
 	/* Initialize the attributes of the new node */
 	new_node->n = value;
+	new_node->meta = 0;
 	new_node->parent = parent;
 	new_node->left = NULL;
 	new_node->right = NULL;
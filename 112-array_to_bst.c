@@ -15,44 +15,55 @@
  * and the number of
  * elements in the array (`size`). If the `array`
  * pointer is NULL, the function
- * returns NULL. The function iterates over
- * the elements in the array and checks
- * for duplicates. For each unique element,
- * it calls the `bst_insert` function
- * to insert the element into the BST.
- * If the insertion fails, the function
+ * returns NULL. Duplicates are dropped by bulk_unique_order
+ * in O(n log n), then each unique element is inserted
+ * in array order by the `bst_insert` function.
+ * If an insertion fails, the function
  * returns NULL. Finally, it returns
  * a pointer to the root node of the created BST.
+ *
+ * Callers wanting a height-balanced tree whatever the input
+ * order, with a different shape, opt in with array_to_bst_bulk.
  */
 bst_t *array_to_bst(int *array, size_t size)
 {
 	bst_t *tree = NULL;
-	size_t i, j;
-	int inserted;
+	int *values;
+	size_t i, count;
 
-	if (array == NULL)
+	if (array == NULL || size == 0)
 		return (NULL);
-
-	i = 0;
-	do {
-		j = 0;
-		inserted = 1;
-		do {
-			if (array[j] == array[i])
-			{
-				inserted = 0;
-				break;
-			}
-			j++;
-		} while (j < i);
-
-		if (inserted)
+	values = bulk_unique_order(array, size, &count);
+	if (values == NULL)
+		return (NULL);
+	for (i = 0; i < count; i++)
+	{
+		if (bst_insert(&tree, values[i]) == NULL)
 		{
-			if (bst_insert(&tree, array[i]) == NULL)
-				return (NULL);
+			binary_tree_delete(tree);
+			tree = NULL;
+			break;
 		}
-		i++;
-	} while (i < size);
-
+	}
+	free(values);
 	return (tree);
 }
+
+/**
+ * array_to_bst_bulk - Builds a height-balanced BST from an array.
+ *
+ * @array: A pointer to the first element of the array.
+ * @size: The number of elements in @array.
+ *
+ * Return: A pointer to the root node of the created BST,
+ * or NULL on failure.
+ *
+ * Description: Runtime opt-in to bst_bulk_load. The values are sorted
+ * and deduplicated in O(n log n), then linked in O(n), so sorted input
+ * no longer degenerates into a chain. The tree holds the same values as
+ * with array_to_bst, but not the shape of their insertion order.
+ */
+bst_t *array_to_bst_bulk(int *array, size_t size)
+{
+	return (bst_bulk_load(array, size, 0));
+}
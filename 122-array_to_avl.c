@@ -5,34 +5,50 @@
  * the array to be converted.
  * @size: The number of elements in @array.
  * Description: Converts an array of integers
- * into an AVL tree.
+ * into an AVL tree, inserting the first occurrence
+ * of each value in array order. Duplicates are
+ * dropped by bulk_unique_order in O(n log n).
+ * Callers wanting the tree built without any
+ * rotation opt in with array_to_avl_bulk.
  * Return: A pointer to the root node of the created AVL,
  * or NULL upon failure.
  */
 avl_t *array_to_avl(int *array, size_t size)
 {
 	avl_t *tree = NULL;
-	size_t i, j;
-	int unique_count = 0;
+	int *values;
+	size_t i, count;
 
-	if (array == NULL)
+	if (array == NULL || size == 0)
 		return (NULL);
-
-	for (i = 0; i < size; i++)
+	values = bulk_unique_order(array, size, &count);
+	if (values == NULL)
+		return (NULL);
+	for (i = 0; i < count; i++)
 	{
-		for (j = 0; j < i; j++)
-		{
-			if (array[j] == array[i])
-				break;
-		}
-		if (j == i)
+		if (avl_insert(&tree, values[i]) == NULL)
 		{
-			unique_count++;
-			if (avl_insert(&tree, array[i]) == NULL)
-				return (NULL);
+			binary_tree_delete(tree);
+			tree = NULL;
+			break;
 		}
 	}
-
-	/*printf("Total unique elements inserted: %d\n", unique_count);*/
+	free(values);
 	return (tree);
 }
+
+/**
+ * array_to_avl_bulk - Builds an AVL tree from an array without rotating.
+ * @array: A pointer to the first element of the array.
+ * @size: The number of elements in @array.
+ * Description: Runtime opt-in to bst_bulk_load, which sorts and
+ * deduplicates the values in O(n log n) then links them in O(n). The
+ * heights are stored in the meta fields, so the tree can be updated
+ * with avl_insert and avl_remove afterwards.
+ * Return: A pointer to the root node of the created AVL,
+ * or NULL upon failure.
+ */
+avl_t *array_to_avl_bulk(int *array, size_t size)
+{
+	return (bst_bulk_load(array, size, 0));
+}
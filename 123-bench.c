@@ -0,0 +1,106 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/*
+ * gcc -O2 123-bench.c 123-avl_remove.c 121-avl_insert.c 153-avl_retrace.c
+ *     120-binary_tree_is_avl.c 103-binary_tree_rotate_left.c
+ *     104-binary_tree_rotate_right.c 3-binary_tree_delete.c
+ *     0-binary_tree_node.c -o 123-bench
+ *
+ * ./123-bench [max_exponent], sizes 10^4 up to 10^max_exponent (default 6)
+ */
+
+/**
+ * seconds - Reads a monotonic clock
+ *
+ * Return: The current time in seconds
+ */
+double seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec + now.tv_nsec / 1e9);
+}
+
+/**
+ * shuffle - Shuffles an array of keys
+ *
+ * @keys: The array to shuffle
+ * @n: Number of keys
+ */
+void shuffle(int *keys, size_t n)
+{
+    size_t i, j;
+    int tmp;
+
+    for (i = n; i > 1; i--)
+    {
+        j = ((size_t)rand() * (RAND_MAX + 1UL) + rand()) % i;
+        tmp = keys[i - 1];
+        keys[i - 1] = keys[j];
+        keys[j] = tmp;
+    }
+}
+
+/**
+ * bench_size - Inserts n shuffled keys, then removes half of them
+ *
+ * @n: Number of keys
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int bench_size(size_t n)
+{
+    int *keys;
+    avl_t *tree = NULL;
+    size_t i;
+    double start, insert, removal;
+
+    keys = malloc(sizeof(*keys) * n);
+    if (!keys)
+        return (1);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)i;
+    shuffle(keys, n);
+    start = seconds();
+    for (i = 0; i < n; i++)
+        avl_insert(&tree, keys[i]);
+    insert = seconds() - start;
+    shuffle(keys, n);
+    start = seconds();
+    for (i = 0; i < n / 2; i++)
+        tree = avl_remove(tree, keys[i]);
+    removal = seconds() - start;
+    printf("%8lu keys, avl_insert %7.1f ns/op, avl_remove of half %7.1f"
+           " ns/op, AVL after: %d\n", (unsigned long)n, insert / n * 1e9,
+           removal / (n / 2) * 1e9, binary_tree_is_avl(tree));
+    binary_tree_delete(tree);
+    free(keys);
+    return (0);
+}
+
+/**
+ * main - Benchmarks avl_insert and avl_remove
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments, the optional largest power of ten to measure
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int argc, char **argv)
+{
+    int max = argc > 1 ? atoi(argv[1]) : 6, e;
+    size_t n = 1000;
+
+    srand(45);
+    for (e = 4; e <= max; e++)
+    {
+        n *= 10;
+        if (bench_size(n))
+            return (1);
+    }
+    return (0);
+}
@@ -14,7 +14,8 @@
  * element as a new node to the AVL tree. It then
  * recursively creates the left and
  * right subtrees by calling itself with the
- * appropriate parameters.
+ * appropriate parameters, and stores the height
+ * of the new node in its meta field.
  *
  * @node: A double pointer to the current
  * node in the AVL tree.
@@ -48,6 +49,7 @@ void create_tree(avl_t **node, int *array, size_t size, int mode)
 		create_tree(&((*node)->right), array, middle, 1);
 		create_tree(&((*node)->right), array + middle + 1, (size - 1 - middle), 2);
 	}
+	avl_update_height(new_node);
 }
 /**
  * sorted_array_to_avl - Creates an AVL tree from a sorted array.
@@ -59,6 +61,8 @@ void create_tree(avl_t **node, int *array, size_t size, int mode)
  * the AVL tree. The create_tree function adds the middle
  * element of the array as the
  * root node and recursively creates the left and right subtrees.
+ * Node heights are stored in the meta fields, so the tree can
+ * be updated by avl_insert and avl_remove in O(log n).
  *
  * @array: The input array of integers.
  * @size: The size of the array.
@@ -84,6 +88,7 @@ avl_t *sorted_array_to_avl(int *array, size_t size)
 
 	create_tree(&root, array, middle, 1);
 	create_tree(&root, array + middle + 1, (size - 1 - middle), 2);
+	avl_update_height(root);
 
 	return (root);
 }
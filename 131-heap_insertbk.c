@@ -8,7 +8,8 @@
  * The function first
  * checks if the root is NULL and creates a new node
  * with the given value if it is.
- * It then traverses the heap to find the appropriate
+ * It counts the nodes with heap_size in O(log^2 n),
+ * then traverses the heap to find the appropriate
  * empty slot for insertion based
  * on the binary representation of the number of leaves.
  * The function creates a new
@@ -34,20 +35,18 @@ heap_t *heap_insert(heap_t **root, int value)
 	if (!(*root))
 		return (*root = binary_tree_node(NULL, value));
 	tree = *root;
-	size = binary_tree_size(tree);
+	size = heap_size(tree);
 	leaves = size;
 	for (level = 0, sub = 1; leaves >= sub; sub *= 2, level++)
 		leaves -= sub;
 
-	parent = NULL;
-	while (tree != NULL)
-	{
-		parent = tree;
-		for (bit = 1 << (level - 1); bit != 1; bit >>= 1)
-			tree = leaves & bit ? tree->right : tree->left;
-	}
+	for (bit = 1 << (level - 1); bit != 1; bit >>= 1)
+		tree = leaves & bit ? tree->right : tree->left;
+	parent = tree;
 
 	new = binary_tree_node(parent, value);
+	if (!new)
+		return (NULL);
 	leaves & 1 ? (parent->right = new) : (parent->left = new);
 
 	flip = new;
@@ -56,36 +55,9 @@ heap_t *heap_insert(heap_t **root, int value)
 		tmp = flip->n;
 		flip->n = flip->parent->n;
 		flip->parent->n = tmp;
-		new = new->parent;
+		flip = flip->parent;
 	}
 
-	return (new);
+	return (flip);
 }
 
-/**
- * binary_tree_size - Measures the size of a binary tree.
- *
- * This function calculates the size of a binary tree.
- * It takes a pointer to the root
- * node of the binary tree. The size of a binary
- * tree is defined as the total number
- * of nodes in the tree. The function recursively
- * calculates the size by summing up
- * the sizes of the left and right subtrees and
- * adding 1 for the current node.
- *
- * @tree: A pointer to the root node of the binary tree.
- *
- * Return: The size of the binary tree.
- *         0 if the tree is NULL.
- */
-size_t binary_tree_size(const binary_tree_t *tree)
-{
-	if (!tree)
-		return (0);
-
-	size_t left_tree_size = binary_tree_size(tree->left);
-	size_t right_tree_size = binary_tree_size(tree->right);
-
-	return (left_tree_size + right_tree_size + 1);
-}
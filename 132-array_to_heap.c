@@ -7,10 +7,10 @@
  * and the size of the array and builds a
  * Max Binary Heap tree from it. It iterates through
  * the array and calls the
- * heap_insert function to insert each element into
- * the Max Binary Heap. The heap_insert
- * function ensures that the heap property is
- * maintained after each insertion.
+ * heap_handle_insert function to insert each element into
+ * the Max Binary Heap. The handle keeps the node count,
+ * so each insertion costs O(log n) and the whole build
+ * O(n log n).
  *
  * @array: A pointer to the first element of
  * the array to be converted.
@@ -22,15 +22,20 @@
  */
 heap_t *array_to_heap(int *array, size_t size)
 {
-	unsigned int i;
-	heap_t *root = NULL;
-	heap_t *new_root;
+	heap_handle_t heap;
+	size_t i;
 
+	if (!array)
+		return (NULL);
+	heap_handle_init(&heap, NULL);
 	for (i = 0; i < size; i++)
 	{
-		new_root = heap_insert(&root, array[i]);
-		root = new_root;
+		if (!heap_handle_insert(&heap, array[i]))
+		{
+			binary_tree_delete(heap.root);
+			return (NULL);
+		}
 	}
 
-	return (root);
+	return (heap.root);
 }
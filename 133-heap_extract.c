@@ -1,120 +1,6 @@
 #include "binary_trees.h"
 #include <stdlib.h>
 
-/**
- * tree_height - Measures the height of a binary tree.
- *
- * This function takes a pointer to the root
- * node of a binary tree and calculates the
- * height of the tree. The height of a binary
- * tree is defined as the number of edges
- * on the longest path from the root to a leaf node.
- * The function recursively calculates
- * the height by traversing the left and right subtrees
- * and adding 1 for each level
- * visited. The height of an empty tree is 0.
- *
- * @tree: Pointer to the root node of the tree
- * to measure the height.
- *
- * Return: The height of the tree or 0 if the tree is NULL.
- */
-size_t tree_height(const heap_t *tree)
-{
-	size_t left_tree_height = 0;
-	size_t right_tree_height = 0;
-	size_t max_height;
-
-	if (!tree)
-		return (0);
-
-	if (tree->left)
-		left_tree_height = 1 + tree_height(tree->left);
-
-	if (tree->right)
-		right_tree_height = 1 + tree_height(tree->right);
-	max_height = (left_tree_height > right_tree_height)
-		? left_tree_height
-		: right_tree_height;
-
-	return (max_height);
-}
-
-/**
- * tree_size_h - Measures the sum of heights of a binary tree.
- *
- * This function takes a pointer to the root
- * node of a binary tree and calculates the
- * sum of heights of the tree. The sum of heights
- * is defined as the sum of the heights
- * of all the individual nodes in the tree.
- * The function recursively calculates the
- * sum of heights by traversing the left and
- * right subtrees and adding 1 for each level
- * visited. The sum of heights of an empty tree is 0.
- *
- * @tree: Pointer to the root node of the
- * tree to measure the sum of heights.
- *
- * Return: The sum of heights of
- * the tree or 0 if the tree is NULL.
- */
-size_t tree_size_h(const binary_tree_t *tree)
-{
-	size_t left_tree_size = 0;
-	size_t right_tree_size = 0;
-	size_t total_size;
-
-	if (!tree)
-		return (0);
-
-	if (tree->left)
-		left_tree_size = 1 + tree_size_h(tree->left);
-
-	if (tree->right)
-		right_tree_size = 1 + tree_size_h(tree->right);
-
-	total_size = left_tree_size + right_tree_size;
-	return (total_size);
-}
-
-/**
- * _preorder - Performs pre-order traversal on a binary tree.
- *
- * This function performs a pre-order traversal on a binary tree.
- * It takes a pointer to
- * the root node of the tree, a pointer to the last
- * node visited during traversal, and
- * the height of the tree. The function recursively
- * traverses the tree in pre-order
- * fashion and updates the last visited node when
- * the desired height is reached.
- *
- * @tree: Pointer to the root node of the tree to traverse.
- * @node: Pointer to the last node visited during traversal.
- * @height: The height of the tree.
- *
- * Return: No return value.
- */
-void _preorder(heap_t *tree, heap_t **node, size_t height)
-{
-	heap_t *left_subtree, *right_subtree;
-	size_t new_height;
-
-	if (!tree)
-		return;
-
-	if (!height)
-		*node = tree;
-	new_height = height - 1;
-
-	left_subtree = tree->left;
-	right_subtree = tree->right;
-
-	_preorder(left_subtree, node, new_height);
-	_preorder(right_subtree, node, new_height);
-}
-
 /**
  * heapify - Heapifies a Max Binary Heap.
  *
@@ -160,50 +46,73 @@ void heapify(heap_t *root)
 	}
 }
 
+/**
+ * heap_handle_extract - Extracts the root node from a Max Binary Heap.
+ *
+ * This function takes a heap handle and removes the
+ * greatest value of the heap. The last node of the heap
+ * is found by heap_node_at from the node count kept in
+ * the handle, its value replaces the root's, the last node
+ * is freed and heapify restores the heap property. Each
+ * step costs O(log n).
+ *
+ * @heap: A pointer to the heap handle.
+ *
+ * Return: The value of the extracted node, or 0 if the heap is empty.
+ **/
+int heap_handle_extract(heap_handle_t *heap)
+{
+	int extracted_value;
+	heap_t *last_node;
+
+	if (!heap || !heap->root)
+		return (0);
+	extracted_value = heap->root->n;
+	last_node = heap_node_at(heap->root, heap->size);
+	heap->size--;
+	if (last_node == heap->root)
+	{
+		heap->root = NULL;
+		free(last_node);
+		return (extracted_value);
+	}
+	heap->root->n = last_node->n;
+	if (last_node->parent->right == last_node)
+		last_node->parent->right = NULL;
+	else
+		last_node->parent->left = NULL;
+	free(last_node);
+	heapify(heap->root);
+	return (extracted_value);
+}
+
 /**
  * heap_extract - Extracts the root node from a Max Binary Heap.
  *
  * This function extracts the root node from a Max Binary Heap.
- *
- *It takes a double pointer
+ * It takes a double pointer
  * to the heap root. The function returns the value of
  * the extracted node and updates the
- * heap structure accordingly. It replaces the root node
- * with the last node in the heap,
- * performs heapify to maintain the heap property, and frees
- * the memory of the extracted node.
+ * heap structure accordingly. The nodes are counted by
+ * heap_size in O(log^2 n), then heap_handle_extract
+ * replaces the root value with the one of the last node,
+ * frees that node and heapifies. Code extracting many
+ * values should keep a heap_handle_t instead, so each
+ * extraction costs O(log n).
  *
  * @root: Double pointer to the heap root.
  *
- * Return: The value of the extracted node.
+ * Return: The value of the extracted node, or 0 on failure.
  **/
 int heap_extract(heap_t **root)
 {
+	heap_handle_t heap;
 	int extracted_value;
-	heap_t *heap_root, *node_to_extract;
-	heap_t *node_parent;
 
 	if (!root || !*root)
 		return (0);
-	heap_root = *root;
-	extracted_value = heap_root->n;
-	if (!heap_root->left && !heap_root->right)
-	{
-		*root = NULL;
-		free(heap_root);
-		return (extracted_value);
-	}
-
-	_preorder(heap_root, &node_to_extract, tree_height(heap_root));
-
-	heap_root->n = node_to_extract->n;
-	node_parent = node_to_extract->parent;
-	if (node_parent->right)
-		node_parent->right = NULL;
-	else
-		node_parent->left = NULL;
-	free(node_to_extract);
-	heapify(heap_root);
-	*root = heap_root;
+	heap_handle_init(&heap, *root);
+	extracted_value = heap_handle_extract(&heap);
+	*root = heap.root;
 	return (extracted_value);
 }
@@ -0,0 +1,139 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/*
+ * Link with one binary_trees_ancestor variant at a time, e.g.:
+ * gcc -O2 140-bench.c 140-lca_index.c 140-lca_index_query.c
+ *     100-binary_trees_ancestor.c 111-bst_insert.c 11-binary_tree_size.c
+ *     3-binary_tree_delete.c 0-binary_tree_node.c -o 140-bench
+ * 140-bench.sh builds and runs it against all three variants.
+ *
+ * Every answer is checked against a depth-equalized parent walk. The
+ * 100-* variants climb both nodes in lockstep and return wrong ancestors
+ * for nodes at different depths, so their error count is expected to be
+ * large; lca_index_query must have none.
+ */
+
+#define NODES 200000
+#define QUERIES 2000000
+
+/**
+ * collect - Stores every node of a tree in an array
+ *
+ * @tree: Root of the tree
+ * @nodes: Array receiving the nodes
+ * @i: Next free position in @nodes
+ */
+void collect(binary_tree_t *tree, binary_tree_t **nodes, size_t *i)
+{
+    if (!tree)
+        return;
+    nodes[(*i)++] = tree;
+    collect(tree->left, nodes, i);
+    collect(tree->right, nodes, i);
+}
+
+/**
+ * elapsed - Seconds elapsed since a given clock value
+ *
+ * @start: Clock value at the start of the measure
+ *
+ * Return: Elapsed CPU time in seconds
+ */
+double elapsed(clock_t start)
+{
+    return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * reference_ancestor - Lowest common ancestor by a plain parent walk
+ *
+ * @first: First node
+ * @second: Second node, in the same tree as @first
+ *
+ * Return: The lowest common ancestor of @first and @second
+ */
+binary_tree_t *reference_ancestor(const binary_tree_t *first,
+                                  const binary_tree_t *second)
+{
+    const binary_tree_t *node;
+    size_t first_depth = 0, second_depth = 0;
+
+    for (node = first; node->parent; node = node->parent)
+        first_depth++;
+    for (node = second; node->parent; node = node->parent)
+        second_depth++;
+    for (; first_depth > second_depth; first_depth--)
+        first = first->parent;
+    for (; second_depth > first_depth; second_depth--)
+        second = second->parent;
+    while (first != second)
+    {
+        first = first->parent;
+        second = second->parent;
+    }
+    return ((binary_tree_t *)first);
+}
+
+/**
+ * main - Benchmarks binary_trees_ancestor against lca_index_query
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(void)
+{
+    bst_t *root = NULL;
+    binary_tree_t **nodes, **pairs, *expected;
+    lca_index_t *index;
+    size_t i, n = 0, index_errors = 0, baseline_errors = 0;
+    clock_t start;
+    long checksum = 0;
+
+    srand(42);
+    for (i = 0; i < NODES; i++)
+        bst_insert(&root, rand());
+    nodes = malloc(sizeof(*nodes) * binary_tree_size(root));
+    pairs = malloc(sizeof(*pairs) * 2 * QUERIES);
+    if (!nodes || !pairs)
+        return (1);
+    collect(root, nodes, &n);
+    for (i = 0; i < 2 * QUERIES; i++)
+        pairs[i] = nodes[rand() % n];
+
+    start = clock();
+    for (i = 0; i < QUERIES; i++)
+        checksum += binary_trees_ancestor(pairs[2 * i], pairs[2 * i + 1]) != 0;
+    printf("binary_trees_ancestor: %.3fs\n", elapsed(start));
+
+    start = clock();
+    index = lca_index_create(root);
+    if (!index)
+        return (1);
+    printf("lca_index_create: %.3fs (%lu nodes)\n", elapsed(start),
+           (unsigned long)n);
+    start = clock();
+    for (i = 0; i < QUERIES; i++)
+        checksum += lca_index_query(index, pairs[2 * i], pairs[2 * i + 1]) != 0;
+    printf("lca_index_query: %.3fs\n", elapsed(start));
+
+    for (i = 0; i < QUERIES; i++)
+    {
+        expected = reference_ancestor(pairs[2 * i], pairs[2 * i + 1]);
+        index_errors += lca_index_query(index, pairs[2 * i],
+                                        pairs[2 * i + 1]) != expected;
+        baseline_errors += binary_trees_ancestor(pairs[2 * i],
+                                                 pairs[2 * i + 1]) != expected;
+    }
+    printf("%lu queries (checksum %ld), wrong answers:\n",
+           (unsigned long)QUERIES, checksum);
+    printf("  lca_index_query: %lu\n", (unsigned long)index_errors);
+    printf("  binary_trees_ancestor (baseline variant): %lu\n",
+           (unsigned long)baseline_errors);
+    lca_index_delete(index);
+    binary_tree_delete(root);
+    free(nodes);
+    free(pairs);
+    return (index_errors != 0);
+}
@@ -0,0 +1,16 @@
+#!/bin/sh
+# Builds 140-bench against each binary_trees_ancestor variant and runs it.
+# Usage: ./140-bench.sh (from the repository root)
+
+set -e
+for variant in 100-binary_trees_ancestor.c 100-long_binary_trees_ancestor.c \
+	100-short_binary_trees_ancestor.c
+do
+	echo "== $variant"
+	gcc -O2 -Wall -Werror -Wextra -pedantic -std=gnu89 140-bench.c \
+		140-lca_index.c 140-lca_index_query.c "$variant" \
+		111-bst_insert.c 11-binary_tree_size.c 3-binary_tree_delete.c \
+		0-binary_tree_node.c -o 140-bench
+	./140-bench
+done
+rm -f 140-bench
@@ -0,0 +1,162 @@
+#include "binary_trees.h"
+
+/**
+ * lca_euler_tour - Records the Euler tour of a binary tree.
+ *
+ * @root: A pointer to the root node of the tree to walk.
+ * @euler: Array receiving the 2n - 1 nodes of the tour.
+ * @depth: Array receiving the depth of each tour entry.
+ *
+ * Description: The walk climbs back through the parent pointers instead
+ * of recursing, so degenerate trees do not exhaust the call stack.
+ * A node is recorded when it is entered and again after each of its
+ * children has been visited.
+ */
+void lca_euler_tour(const binary_tree_t *root, const binary_tree_t **euler,
+		size_t *depth)
+{
+	const binary_tree_t *node, *prev, *next, *top;
+	size_t i = 0, d = 0;
+
+	top = root->parent;
+	prev = top;
+	node = root;
+	while (node != top)
+	{
+		euler[i] = node;
+		depth[i++] = d;
+		if (prev == node->parent)
+			next = node->left ? node->left :
+				node->right ? node->right : node->parent;
+		else if (prev == node->left && node->right)
+			next = node->right;
+		else
+			next = node->parent;
+		if (next == node->parent)
+			d--;
+		else
+			d++;
+		prev = node;
+		node = next;
+	}
+}
+
+/**
+ * lca_hash_insert - Maps each node to its first Euler tour position.
+ *
+ * @index: A pointer to the index being built.
+ *
+ * Description: Uses open addressing with linear probing. The Euler tour
+ * is scanned from the end so the first occurrence wins.
+ */
+void lca_hash_insert(lca_index_t *index)
+{
+	size_t i, slot;
+
+	for (i = index->tour_size; i-- > 0;)
+	{
+		slot = lca_hash(index->euler[i], index->mask);
+		while (index->slots[slot].node != NULL &&
+				index->slots[slot].node != index->euler[i])
+			slot = (slot + 1) & index->mask;
+		index->slots[slot].node = index->euler[i];
+		index->slots[slot].first = i;
+	}
+}
+
+/**
+ * lca_sparse_build - Fills the sparse table over the Euler tour depths.
+ *
+ * @index: A pointer to the index being built.
+ *
+ * Description: Row k holds, for every position i, the tour position of
+ * the shallowest entry in [i, i + 2^k). Each row is derived from the
+ * previous one, for O(n log n) total work.
+ */
+void lca_sparse_build(lca_index_t *index)
+{
+	size_t i, k, half, m = index->tour_size;
+	size_t *row, *prev;
+
+	index->log2[1] = 0;
+	for (i = 2; i <= m; i++)
+		index->log2[i] = index->log2[i / 2] + 1;
+	for (i = 0; i < m; i++)
+		index->sparse[i] = i;
+	for (k = 1; k < index->levels; k++)
+	{
+		prev = index->sparse + (k - 1) * m;
+		row = index->sparse + k * m;
+		half = (size_t)1 << (k - 1);
+		for (i = 0; i + 2 * half <= m; i++)
+		{
+			row[i] = prev[i + half];
+			if (index->depth[prev[i]] <= index->depth[row[i]])
+				row[i] = prev[i];
+		}
+	}
+}
+
+/**
+ * lca_index_create - Builds a lowest common ancestor index over a tree.
+ *
+ * @root: A pointer to the root node of the tree to index.
+ *
+ * Return: A pointer to the new index, or NULL on failure.
+ *
+ * Description: The tree must not change while the index is in use.
+ * Building costs O(n log n) time and memory; each lca_index_query
+ * afterwards costs O(1).
+ */
+lca_index_t *lca_index_create(const binary_tree_t *root)
+{
+	lca_index_t *index;
+	size_t n;
+
+	if (root == NULL)
+		return (NULL);
+	index = calloc(1, sizeof(*index));
+	if (index == NULL)
+		return (NULL);
+	n = binary_tree_size(root);
+	index->tour_size = 2 * n - 1;
+	index->levels = 1;
+	while (((size_t)1 << index->levels) <= index->tour_size)
+		index->levels++;
+	for (index->mask = 1; index->mask < 2 * n;)
+		index->mask <<= 1;
+	index->euler = malloc(sizeof(*index->euler) * index->tour_size);
+	index->depth = malloc(sizeof(*index->depth) * index->tour_size);
+	index->sparse = malloc(sizeof(*index->sparse) * index->tour_size *
+			index->levels);
+	index->log2 = malloc(sizeof(*index->log2) * (index->tour_size + 1));
+	index->slots = calloc(index->mask, sizeof(*index->slots));
+	index->mask--;
+	if (!index->euler || !index->depth || !index->sparse || !index->log2 ||
+			!index->slots)
+	{
+		lca_index_delete(index);
+		return (NULL);
+	}
+	lca_euler_tour(root, index->euler, index->depth);
+	lca_hash_insert(index);
+	lca_sparse_build(index);
+	return (index);
+}
+
+/**
+ * lca_index_delete - Frees a lowest common ancestor index.
+ *
+ * @index: A pointer to the index to free. The indexed tree is untouched.
+ */
+void lca_index_delete(lca_index_t *index)
+{
+	if (index == NULL)
+		return;
+	free(index->euler);
+	free(index->depth);
+	free(index->sparse);
+	free(index->log2);
+	free(index->slots);
+	free(index);
+}
@@ -0,0 +1,86 @@
+#include "binary_trees.h"
+
+/**
+ * lca_hash - Hashes a node address into the index slot table.
+ *
+ * @node: The node to hash.
+ * @mask: The slot table size minus one (the size is a power of two).
+ *
+ * Return: The home slot of @node.
+ */
+size_t lca_hash(const binary_tree_t *node, size_t mask)
+{
+	size_t h = (size_t)node >> 4;
+
+	h ^= h >> 16;
+	h *= 2654435761UL;
+	h ^= h >> 13;
+	return (h & mask);
+}
+
+/**
+ * lca_index_find - Looks up the first Euler tour position of a node.
+ *
+ * @index: A pointer to the index to search.
+ * @node: The node to look up.
+ * @first: Address where the position is stored when found.
+ *
+ * Return: 1 if @node belongs to the indexed tree, 0 otherwise.
+ */
+int lca_index_find(const lca_index_t *index, const binary_tree_t *node,
+		size_t *first)
+{
+	size_t slot = lca_hash(node, index->mask);
+
+	while (index->slots[slot].node != NULL)
+	{
+		if (index->slots[slot].node == node)
+		{
+			*first = index->slots[slot].first;
+			return (1);
+		}
+		slot = (slot + 1) & index->mask;
+	}
+	return (0);
+}
+
+/**
+ * lca_index_query - Finds the lowest common ancestor of two nodes.
+ *
+ * @index: A pointer to an index built by lca_index_create.
+ * @first: Pointer to the first node.
+ * @second: Pointer to the second node.
+ *
+ * Return: A pointer to the lowest common ancestor, or NULL if either
+ *         node is NULL or does not belong to the indexed tree.
+ *
+ * Description: Same result as binary_trees_ancestor, in O(1): the
+ * ancestor is the shallowest Euler tour entry between the first
+ * occurrences of both nodes, read from two overlapping sparse table
+ * ranges.
+ */
+binary_tree_t *lca_index_query(const lca_index_t *index,
+		const binary_tree_t *first, const binary_tree_t *second)
+{
+	size_t lo, hi, tmp, k, a, b;
+	const size_t *row;
+
+	if (index == NULL || first == NULL || second == NULL)
+		return (NULL);
+	if (!lca_index_find(index, first, &lo) ||
+			!lca_index_find(index, second, &hi))
+		return (NULL);
+	if (lo > hi)
+	{
+		tmp = lo;
+		lo = hi;
+		hi = tmp;
+	}
+	k = index->log2[hi - lo + 1];
+	row = index->sparse + k * index->tour_size;
+	a = row[lo];
+	b = row[hi + 1 - ((size_t)1 << k)];
+	if (index->depth[b] < index->depth[a])
+		a = b;
+	return ((binary_tree_t *)index->euler[a]);
+}
@@ -0,0 +1,58 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * launch_test - Test the LCA index and print informations
+ *
+ * @index: LCA index of the tree
+ * @n1: First node
+ * @n2: Second node
+ */
+void launch_test(lca_index_t *index, binary_tree_t *n1, binary_tree_t *n2)
+{
+    binary_tree_t *ancestor;
+
+    ancestor = lca_index_query(index, n1, n2);
+    printf("Ancestor of [%d] & [%d]: ", n1->n, n2->n);
+    if (!ancestor)
+        printf("(nil)\n");
+    else
+        printf("%d\n", ancestor->n);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: Always 0 (Success)
+ */
+int main(void)
+{
+    binary_tree_t *root, *other;
+    lca_index_t *index;
+
+    root = binary_tree_node(NULL, 98);
+    root->left = binary_tree_node(root, 12);
+    root->right = binary_tree_node(root, 402);
+    root->left->right = binary_tree_node(root->left, 54);
+    root->right->right = binary_tree_node(root->right, 128);
+    root->left->left = binary_tree_node(root->left, 10);
+    root->right->left = binary_tree_node(root->right, 45);
+    root->right->right->left = binary_tree_node(root->right->right, 92);
+    root->right->right->right = binary_tree_node(root->right->right, 65);
+    other = binary_tree_node(NULL, 7);
+    binary_tree_print(root);
+
+    index = lca_index_create(root);
+    if (!index)
+        return (1);
+    launch_test(index, root->left, root->right);
+    launch_test(index, root->right->left, root->right->right->right);
+    launch_test(index, root->right->right, root->right->right->right);
+    launch_test(index, root->left->left, root->left->left);
+    launch_test(index, root->left, other);
+    lca_index_delete(index);
+    binary_tree_delete(root);
+    binary_tree_delete(other);
+    return (0);
+}
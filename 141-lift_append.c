@@ -0,0 +1,154 @@
+#include "binary_trees.h"
+
+/**
+ * lift_preorder - Numbers the nodes of a tree in preorder.
+ *
+ * @root: A pointer to the root node of the tree to walk.
+ * @nodes: Array receiving the nodes.
+ * @depth: Array receiving the depth of each node below @root.
+ *
+ * Return: The number of nodes stored.
+ *
+ * Description: The walk climbs back through the parent pointers, so it
+ * needs no stack even on degenerate trees.
+ */
+size_t lift_preorder(const binary_tree_t *root, const binary_tree_t **nodes,
+		size_t *depth)
+{
+	const binary_tree_t *node = root, *prev = root->parent, *next;
+	size_t i = 0, d = 0;
+
+	while (node != root->parent)
+	{
+		if (prev == node->parent)
+		{
+			nodes[i] = node;
+			depth[i++] = d;
+		}
+		if (prev == node->parent && (node->left || node->right))
+			next = node->left ? node->left : node->right;
+		else if (prev == node->left && node->right)
+			next = node->right;
+		else
+			next = node->parent;
+		if (next == node->parent)
+			d--;
+		else
+			d++;
+		prev = node;
+		node = next;
+	}
+	return (i);
+}
+
+/**
+ * lift_rehash - Rebuilds the hash slots of a lifting table.
+ *
+ * @table: A pointer to the lifting table.
+ *
+ * Return: 1 on success, 0 on allocation failure (the table is unchanged).
+ */
+int lift_rehash(lift_table_t *table)
+{
+	lca_slot_t *slots;
+	size_t i, count;
+
+	for (count = 1; count < 2 * table->capacity;)
+		count <<= 1;
+	slots = calloc(count, sizeof(*slots));
+	if (slots == NULL)
+		return (0);
+	free(table->slots);
+	table->slots = slots;
+	table->mask = count - 1;
+	for (i = 0; i < table->size; i++)
+		lift_slot_insert(table, i);
+	return (1);
+}
+
+/**
+ * lift_reserve - Doubles the capacity of a lifting table.
+ *
+ * @table: A pointer to the lifting table.
+ *
+ * Return: 1 on success, 0 on allocation failure.
+ */
+int lift_reserve(lift_table_t *table)
+{
+	size_t capacity = table->capacity * 2;
+	const binary_tree_t **nodes;
+	size_t *depth;
+	unsigned int *up;
+
+	nodes = realloc(table->nodes, sizeof(*nodes) * capacity);
+	if (nodes == NULL)
+		return (0);
+	table->nodes = nodes;
+	depth = realloc(table->depth, sizeof(*depth) * capacity);
+	if (depth == NULL)
+		return (0);
+	table->depth = depth;
+	up = realloc(table->up, sizeof(*up) * capacity * table->levels);
+	if (up == NULL)
+		return (0);
+	table->up = up;
+	table->capacity = capacity;
+	return (lift_rehash(table));
+}
+
+/**
+ * lift_relevel - Adds one jump level to every row of a lifting table.
+ *
+ * @table: A pointer to the lifting table.
+ *
+ * Return: 1 on success, 0 on allocation failure.
+ */
+int lift_relevel(lift_table_t *table)
+{
+	unsigned int *up;
+	size_t i;
+
+	up = malloc(sizeof(*up) * table->capacity * (table->levels + 1));
+	if (up == NULL)
+		return (0);
+	free(table->up);
+	table->up = up;
+	table->levels++;
+	for (i = 0; i < table->size; i++)
+		lift_fill_row(table, i);
+	return (1);
+}
+
+/**
+ * lift_table_append - Extends a lifting table with a newly attached leaf.
+ *
+ * @table: A pointer to the lifting table.
+ * @leaf: The new node. Its parent must already be indexed.
+ *
+ * Return: 1 on success, 0 if @leaf cannot be indexed.
+ *
+ * Description: Costs O(log h) amortized. The table doubles its storage
+ * when full and gains a level when the tree gets twice as deep.
+ */
+int lift_table_append(lift_table_t *table, const binary_tree_t *leaf)
+{
+	size_t parent, i;
+
+	if (table == NULL || leaf == NULL || lift_index_of(table, leaf) !=
+			(size_t)-1)
+		return (0);
+	parent = lift_index_of(table, leaf->parent);
+	if (parent == (size_t)-1)
+		return (0);
+	if (table->size == table->capacity && !lift_reserve(table))
+		return (0);
+	if (table->depth[parent] + 1 >= (size_t)1 << table->levels &&
+			!lift_relevel(table))
+		return (0);
+	i = table->size++;
+	table->nodes[i] = leaf;
+	table->depth[i] = table->depth[parent] + 1;
+	lift_slot_insert(table, i);
+	lift_fill_row(table, i);
+	return (1);
+}
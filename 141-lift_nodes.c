@@ -0,0 +1,85 @@
+#include "binary_trees.h"
+
+/**
+ * lift_kth_ancestor - Finds the k-th ancestor of a node.
+ *
+ * @table: A pointer to a lifting table built over the node's tree.
+ * @node: A pointer to the node.
+ * @k: Number of levels to climb (0 returns @node itself).
+ *
+ * Return: A pointer to the ancestor, or NULL if @node is not indexed or
+ *         has fewer than @k indexed ancestors.
+ */
+binary_tree_t *lift_kth_ancestor(const lift_table_t *table,
+		const binary_tree_t *node, size_t k)
+{
+	size_t i = lift_index_of(table, node);
+
+	if (i == (size_t)-1)
+		return (NULL);
+	i = lift_kth_index(table, i, k);
+	if (i == (size_t)-1)
+		return (NULL);
+	return ((binary_tree_t *)table->nodes[i]);
+}
+
+/**
+ * lift_ancestor - Finds the lowest common ancestor of two nodes.
+ *
+ * @table: A pointer to a lifting table built over the nodes' tree.
+ * @first: Pointer to the first node.
+ * @second: Pointer to the second node.
+ *
+ * Return: A pointer to the lowest common ancestor, or NULL if either
+ *         node is not indexed.
+ */
+binary_tree_t *lift_ancestor(const lift_table_t *table,
+		const binary_tree_t *first, const binary_tree_t *second)
+{
+	size_t a = lift_index_of(table, first);
+	size_t b = lift_index_of(table, second);
+
+	if (a == (size_t)-1 || b == (size_t)-1)
+		return (NULL);
+	return ((binary_tree_t *)table->nodes[lift_lca_index(table, a, b)]);
+}
+
+/**
+ * lift_distance - Counts the edges on the path between two nodes.
+ *
+ * @table: A pointer to a lifting table built over the nodes' tree.
+ * @first: Pointer to the first node.
+ * @second: Pointer to the second node.
+ *
+ * Return: The distance, or (size_t)-1 if either node is not indexed.
+ */
+size_t lift_distance(const lift_table_t *table,
+		const binary_tree_t *first, const binary_tree_t *second)
+{
+	size_t a = lift_index_of(table, first);
+	size_t b = lift_index_of(table, second);
+
+	if (a == (size_t)-1 || b == (size_t)-1)
+		return ((size_t)-1);
+	return (lift_distance_index(table, a, b));
+}
+
+/**
+ * lift_is_ancestor - Checks whether a node is an ancestor of another one.
+ *
+ * @table: A pointer to a lifting table built over the nodes' tree.
+ * @u: Pointer to the candidate ancestor.
+ * @v: Pointer to the candidate descendant.
+ *
+ * Return: 1 if @u is @v or one of its ancestors, 0 otherwise.
+ */
+int lift_is_ancestor(const lift_table_t *table, const binary_tree_t *u,
+		const binary_tree_t *v)
+{
+	size_t a = lift_index_of(table, u);
+	size_t b = lift_index_of(table, v);
+
+	if (a == (size_t)-1 || b == (size_t)-1)
+		return (0);
+	return (lift_is_ancestor_index(table, a, b));
+}
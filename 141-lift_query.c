@@ -0,0 +1,95 @@
+#include "binary_trees.h"
+
+/**
+ * lift_kth_index - Finds the k-th ancestor of a node by position.
+ *
+ * @table: A pointer to the lifting table.
+ * @i: Position of the node.
+ * @k: Number of levels to climb.
+ *
+ * Return: Position of the ancestor, or (size_t)-1 if @k is larger than
+ *         the depth of the node.
+ *
+ * Description: Takes one jump per set bit of @k, O(log h).
+ */
+size_t lift_kth_index(const lift_table_t *table, size_t i, size_t k)
+{
+	size_t bit;
+
+	if (k > table->depth[i])
+		return ((size_t)-1);
+	for (bit = 0; k != 0; bit++, k >>= 1)
+		if (k & 1)
+			i = table->up[i * table->levels + bit];
+	return (i);
+}
+
+/**
+ * lift_lca_index - Finds the lowest common ancestor of two positions.
+ *
+ * @table: A pointer to the lifting table.
+ * @a: Position of the first node.
+ * @b: Position of the second node.
+ *
+ * Return: Position of the lowest common ancestor.
+ *
+ * Description: Brings both nodes to the same depth, then climbs them
+ * together by decreasing powers of two while they stay apart.
+ */
+size_t lift_lca_index(const lift_table_t *table, size_t a, size_t b)
+{
+	size_t k, tmp, l = table->levels;
+
+	if (table->depth[a] < table->depth[b])
+	{
+		tmp = a;
+		a = b;
+		b = tmp;
+	}
+	a = lift_kth_index(table, a, table->depth[a] - table->depth[b]);
+	if (a == b)
+		return (a);
+	for (k = l; k-- > 0;)
+	{
+		if (table->up[a * l + k] != table->up[b * l + k])
+		{
+			a = table->up[a * l + k];
+			b = table->up[b * l + k];
+		}
+	}
+	return (table->up[a * l]);
+}
+
+/**
+ * lift_distance_index - Counts the edges between two positions.
+ *
+ * @table: A pointer to the lifting table.
+ * @a: Position of the first node.
+ * @b: Position of the second node.
+ *
+ * Return: The number of edges on the path between both nodes.
+ */
+size_t lift_distance_index(const lift_table_t *table, size_t a, size_t b)
+{
+	size_t c = lift_lca_index(table, a, b);
+
+	return (table->depth[a] + table->depth[b] - 2 * table->depth[c]);
+}
+
+/**
+ * lift_is_ancestor_index - Checks whether a position is an ancestor
+ * of another one.
+ *
+ * @table: A pointer to the lifting table.
+ * @u: Position of the candidate ancestor.
+ * @v: Position of the candidate descendant.
+ *
+ * Return: 1 if @u is @v or one of its ancestors, 0 otherwise.
+ */
+int lift_is_ancestor_index(const lift_table_t *table, size_t u, size_t v)
+{
+	if (table->depth[u] > table->depth[v])
+		return (0);
+	return (lift_kth_index(table, v,
+				table->depth[v] - table->depth[u]) == u);
+}
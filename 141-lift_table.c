@@ -0,0 +1,124 @@
+#include "binary_trees.h"
+
+/**
+ * lift_slot_insert - Adds a node of a lifting table to its hash slots.
+ *
+ * @table: A pointer to the lifting table.
+ * @i: Position of the node to add in @table->nodes.
+ */
+void lift_slot_insert(lift_table_t *table, size_t i)
+{
+	size_t slot = lca_hash(table->nodes[i], table->mask);
+
+	while (table->slots[slot].node != NULL)
+		slot = (slot + 1) & table->mask;
+	table->slots[slot].node = table->nodes[i];
+	table->slots[slot].first = i;
+}
+
+/**
+ * lift_index_of - Looks up the position of a node in a lifting table.
+ *
+ * @table: A pointer to the lifting table.
+ * @node: The node to look up.
+ *
+ * Return: The position of @node, or (size_t)-1 if it is not indexed.
+ */
+size_t lift_index_of(const lift_table_t *table, const binary_tree_t *node)
+{
+	size_t slot;
+
+	if (table == NULL || node == NULL)
+		return ((size_t)-1);
+	slot = lca_hash(node, table->mask);
+	while (table->slots[slot].node != NULL)
+	{
+		if (table->slots[slot].node == node)
+			return (table->slots[slot].first);
+		slot = (slot + 1) & table->mask;
+	}
+	return ((size_t)-1);
+}
+
+/**
+ * lift_fill_row - Computes the jump row of one node.
+ *
+ * @table: A pointer to the lifting table.
+ * @i: Position of the node. The row of its parent must be filled.
+ *
+ * Description: Entry k of the row is the position of the 2^k-th ancestor
+ * of the node. Jumps past the indexed root stop on the root.
+ */
+void lift_fill_row(lift_table_t *table, size_t i)
+{
+	unsigned int *row = table->up + i * table->levels;
+	size_t k;
+
+	row[0] = i == 0 ? 0 :
+		(unsigned int)lift_index_of(table, table->nodes[i]->parent);
+	for (k = 1; k < table->levels; k++)
+		row[k] = table->up[row[k - 1] * table->levels + k - 1];
+}
+
+/**
+ * lift_table_create - Builds a binary lifting table over a tree.
+ *
+ * @root: A pointer to the root node of the tree to index.
+ *
+ * Return: A pointer to the new table, or NULL on failure.
+ *
+ * Description: Nodes are numbered in preorder, so every parent comes
+ * before its children and the table can be used through node pointers
+ * or through those compact positions. Building costs O(n log h).
+ */
+lift_table_t *lift_table_create(const binary_tree_t *root)
+{
+	lift_table_t *table;
+	size_t i, max_depth = 0;
+
+	if (root == NULL)
+		return (NULL);
+	table = calloc(1, sizeof(*table));
+	if (table == NULL)
+		return (NULL);
+	table->capacity = binary_tree_size(root);
+	table->nodes = malloc(sizeof(*table->nodes) * table->capacity);
+	table->depth = malloc(sizeof(*table->depth) * table->capacity);
+	if (!table->nodes || !table->depth)
+	{
+		lift_table_delete(table);
+		return (NULL);
+	}
+	table->size = lift_preorder(root, table->nodes, table->depth);
+	for (i = 0; i < table->size; i++)
+		if (table->depth[i] > max_depth)
+			max_depth = table->depth[i];
+	for (table->levels = 1; ((size_t)1 << table->levels) <= max_depth;)
+		table->levels++;
+	table->up = malloc(sizeof(*table->up) * table->capacity *
+			table->levels);
+	if (table->up == NULL || !lift_rehash(table))
+	{
+		lift_table_delete(table);
+		return (NULL);
+	}
+	for (i = 0; i < table->size; i++)
+		lift_fill_row(table, i);
+	return (table);
+}
+
+/**
+ * lift_table_delete - Frees a binary lifting table.
+ *
+ * @table: A pointer to the table to free. The indexed tree is untouched.
+ */
+void lift_table_delete(lift_table_t *table)
+{
+	if (table == NULL)
+		return;
+	free(table->nodes);
+	free(table->depth);
+	free(table->up);
+	free(table->slots);
+	free(table);
+}
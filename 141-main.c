@@ -0,0 +1,69 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_node - Prints the value of a node or (nil)
+ *
+ * @label: Text printed before the value
+ * @node: Node to print
+ */
+void print_node(const char *label, binary_tree_t *node)
+{
+    printf("%s: ", label);
+    if (!node)
+        printf("(nil)\n");
+    else
+        printf("%d\n", node->n);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    binary_tree_t *root, *leaf;
+    lift_table_t *table;
+
+    root = binary_tree_node(NULL, 98);
+    root->left = binary_tree_node(root, 12);
+    root->right = binary_tree_node(root, 402);
+    root->left->right = binary_tree_node(root->left, 54);
+    root->right->right = binary_tree_node(root->right, 128);
+    root->left->left = binary_tree_node(root->left, 10);
+    root->right->left = binary_tree_node(root->right, 45);
+    root->right->right->left = binary_tree_node(root->right->right, 92);
+    root->right->right->right = binary_tree_node(root->right->right, 65);
+    binary_tree_print(root);
+
+    table = lift_table_create(root);
+    if (!table)
+        return (1);
+    leaf = root->right->right->right;
+    print_node("1st ancestor of 65", lift_kth_ancestor(table, leaf, 1));
+    print_node("3rd ancestor of 65", lift_kth_ancestor(table, leaf, 3));
+    print_node("4th ancestor of 65", lift_kth_ancestor(table, leaf, 4));
+    print_node("Ancestor of 54 & 92",
+               lift_ancestor(table, root->left->right,
+                             root->right->right->left));
+    printf("Distance 54 -> 65: %lu\n",
+           (unsigned long)lift_distance(table, root->left->right, leaf));
+    printf("Is 402 an ancestor of 65: %d\n",
+           lift_is_ancestor(table, root->right, leaf));
+    printf("Is 12 an ancestor of 65: %d\n",
+           lift_is_ancestor(table, root->left, leaf));
+
+    leaf->left = binary_tree_node(leaf, 1);
+    if (!lift_table_append(table, leaf->left))
+        return (1);
+    binary_tree_print(root);
+    print_node("4th ancestor of 1", lift_kth_ancestor(table, leaf->left, 4));
+    printf("Distance 10 -> 1: %lu\n",
+           (unsigned long)lift_distance(table, root->left->left, leaf->left));
+
+    lift_table_delete(table);
+    binary_tree_delete(root);
+    return (0);
+}
@@ -0,0 +1,133 @@
+#include "binary_trees.h"
+
+/**
+ * lca_batch_number - Numbers the nodes of a tree in preorder and records
+ * the position of each node's parent.
+ *
+ * @root: A pointer to the root node of the tree.
+ * @nodes: Array receiving the nodes.
+ * @up: Array receiving the position of each node's parent (the root
+ * gets its own position).
+ *
+ * Return: The number of nodes stored.
+ */
+size_t lca_batch_number(const binary_tree_t *root,
+		const binary_tree_t **nodes, size_t *up)
+{
+	const binary_tree_t *node = root, *prev = root->parent, *next;
+	size_t i = 0, cur = 0;
+
+	while (node != root->parent)
+	{
+		if (prev == node->parent)
+		{
+			nodes[i] = node;
+			up[i] = cur;
+			cur = i++;
+		}
+		if (prev == node->parent && (node->left || node->right))
+			next = node->left ? node->left : node->right;
+		else if (prev == node->left && node->right)
+			next = node->right;
+		else
+			next = node->parent;
+		if (next == node->parent)
+			cur = up[cur];
+		prev = node;
+		node = next;
+	}
+	return (i);
+}
+
+/**
+ * lca_batch_free - Frees the work arrays of a batch.
+ *
+ * @batch: A pointer to the batch.
+ */
+void lca_batch_free(lca_batch_t *batch)
+{
+	free(batch->map.nodes);
+	free(batch->map.slots);
+	free(batch->up);
+	free(batch->set);
+	free(batch->anc);
+	free(batch->rank);
+	free(batch->done);
+	free(batch->head);
+	free(batch->ends);
+	free(batch->bucket);
+}
+
+/**
+ * lca_batch_alloc - Allocates the work arrays of a batch.
+ *
+ * @batch: A pointer to the zeroed batch.
+ * @n: Number of nodes in the tree.
+ * @count: Number of queries.
+ *
+ * Return: 1 on success, 0 on allocation failure.
+ */
+int lca_batch_alloc(lca_batch_t *batch, size_t n, size_t count)
+{
+	batch->map.nodes = malloc(sizeof(*batch->map.nodes) * n);
+	batch->up = malloc(sizeof(*batch->up) * n);
+	batch->set = malloc(sizeof(*batch->set) * n);
+	batch->anc = malloc(sizeof(*batch->anc) * n);
+	batch->rank = calloc(n, sizeof(*batch->rank));
+	batch->done = calloc(n, sizeof(*batch->done));
+	batch->head = calloc(n + 1, sizeof(*batch->head));
+	batch->ends = malloc(sizeof(*batch->ends) * (2 * count + 1));
+	batch->bucket = malloc(sizeof(*batch->bucket) * (2 * count + 1));
+	return (batch->map.nodes && batch->up && batch->set && batch->anc &&
+			batch->rank && batch->done && batch->head &&
+			batch->ends && batch->bucket);
+}
+
+/**
+ * binary_trees_ancestor_batch - Finds the lowest common ancestor of many
+ * pairs of nodes at once.
+ *
+ * @root: A pointer to the root node of the tree holding the nodes.
+ * @queries: Array of node pairs.
+ * @count: Number of pairs in @queries.
+ * @out: Array of @count entries receiving the ancestor of each pair, or
+ * NULL when a node of the pair is NULL or outside the tree of @root.
+ *
+ * Return: 1 on success, 0 on failure.
+ *
+ * Description: Tarjan's offline algorithm. The pairs are bucketed per
+ * node, then a single pass over the nodes in reverse preorder merges
+ * finished subtrees in a union-find kept in flat arrays, answering
+ * every pair in O(n + count * alpha(n)) overall.
+ */
+int binary_trees_ancestor_batch(const binary_tree_t *root,
+		const lca_query_t *queries, size_t count, binary_tree_t **out)
+{
+	lca_batch_t batch;
+	size_t i, n;
+
+	if (queries == NULL || out == NULL)
+		return (0);
+	for (i = 0; i < count; i++)
+		out[i] = NULL;
+	if (root == NULL)
+		return (1);
+	memset(&batch, 0, sizeof(batch));
+	n = binary_tree_size(root);
+	if (!lca_batch_alloc(&batch, n, count))
+	{
+		lca_batch_free(&batch);
+		return (0);
+	}
+	batch.map.size = lca_batch_number(root, batch.map.nodes, batch.up);
+	batch.map.capacity = batch.map.size;
+	if (!lift_rehash(&batch.map))
+	{
+		lca_batch_free(&batch);
+		return (0);
+	}
+	lca_batch_bucket(&batch, queries, count);
+	lca_batch_resolve(&batch, out);
+	lca_batch_free(&batch);
+	return (1);
+}
@@ -0,0 +1,127 @@
+#include "binary_trees.h"
+
+/**
+ * lca_batch_bucket - Groups the query endpoints by node.
+ *
+ * @batch: A pointer to the batch.
+ * @queries: Array of node pairs.
+ * @count: Number of pairs in @queries.
+ *
+ * Description: Endpoint 2q and 2q + 1 are the first and second node of
+ * pair q. @batch->ends holds the position of each endpoint, and each
+ * node's bucket lists the endpoints facing its own, so the other node of
+ * a pair is always one ends lookup away. Counting sort, O(n + count).
+ */
+void lca_batch_bucket(lca_batch_t *batch, const lca_query_t *queries,
+		size_t count)
+{
+	size_t i, e, sum = 0, n = batch->map.size, *end;
+
+	for (i = 0; i < count; i++)
+	{
+		end = batch->ends + 2 * i;
+		end[0] = lift_index_of(&batch->map, queries[i].first);
+		end[1] = lift_index_of(&batch->map, queries[i].second);
+		if (end[0] == (size_t)-1 || end[1] == (size_t)-1)
+			continue;
+		batch->head[end[0]]++;
+		batch->head[end[1]]++;
+	}
+	for (i = 0; i <= n; i++)
+	{
+		sum += batch->head[i];
+		batch->head[i] = sum;
+	}
+	for (e = 0; e < 2 * count; e++)
+	{
+		if (batch->ends[e] == (size_t)-1 ||
+				batch->ends[e ^ 1] == (size_t)-1)
+			continue;
+		batch->bucket[--batch->head[batch->ends[e]]] = e ^ 1;
+	}
+}
+
+/**
+ * lca_batch_find - Finds the representative of a union-find set.
+ *
+ * @set: The union-find parent array.
+ * @i: Position of a member of the set.
+ *
+ * Return: Position of the representative. Path halving keeps the
+ * chains short.
+ */
+size_t lca_batch_find(size_t *set, size_t i)
+{
+	while (set[i] != i)
+	{
+		set[i] = set[set[i]];
+		i = set[i];
+	}
+	return (i);
+}
+
+/**
+ * lca_batch_union - Merges the set of a finished node into the set of
+ * its parent.
+ *
+ * @batch: A pointer to the batch.
+ * @i: Position of the finished node.
+ *
+ * Description: Union by rank; the merged set is tagged with the parent,
+ * the deepest node of the set still being visited.
+ */
+void lca_batch_union(lca_batch_t *batch, size_t i)
+{
+	size_t a = lca_batch_find(batch->set, i);
+	size_t b = lca_batch_find(batch->set, batch->up[i]);
+
+	if (batch->rank[a] > batch->rank[b])
+	{
+		batch->set[b] = a;
+		b = a;
+	}
+	else
+	{
+		batch->set[a] = b;
+		if (batch->rank[a] == batch->rank[b])
+			batch->rank[b]++;
+	}
+	batch->anc[b] = batch->up[i];
+}
+
+/**
+ * lca_batch_resolve - Answers every bucketed pair.
+ *
+ * @batch: A pointer to the batch.
+ * @out: Array receiving the ancestor of each pair.
+ *
+ * Description: Reverse preorder is the postorder of a right-to-left
+ * depth-first walk, so the nodes can be finished straight from the
+ * arrays: once a node is finished, any already finished node w it is
+ * paired with has its set tagged with their lowest common ancestor.
+ */
+void lca_batch_resolve(lca_batch_t *batch, binary_tree_t **out)
+{
+	size_t i, e, w;
+
+	for (i = 0; i < batch->map.size; i++)
+	{
+		batch->set[i] = i;
+		batch->anc[i] = i;
+	}
+	for (i = batch->map.size; i-- > 0;)
+	{
+		batch->done[i] = 1;
+		for (e = batch->head[i]; e < batch->head[i + 1]; e++)
+		{
+			w = batch->ends[batch->bucket[e]];
+			if (!batch->done[w])
+				continue;
+			w = batch->anc[lca_batch_find(batch->set, w)];
+			out[batch->bucket[e] / 2] =
+				(binary_tree_t *)batch->map.nodes[w];
+		}
+		if (i != 0)
+			lca_batch_union(batch, i);
+	}
+}
@@ -0,0 +1,53 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    binary_tree_t *root, *other;
+    lca_query_t queries[5];
+    binary_tree_t *out[5];
+    size_t i;
+
+    root = binary_tree_node(NULL, 98);
+    root->left = binary_tree_node(root, 12);
+    root->right = binary_tree_node(root, 402);
+    root->left->right = binary_tree_node(root->left, 54);
+    root->right->right = binary_tree_node(root->right, 128);
+    root->left->left = binary_tree_node(root->left, 10);
+    root->right->left = binary_tree_node(root->right, 45);
+    root->right->right->left = binary_tree_node(root->right->right, 92);
+    root->right->right->right = binary_tree_node(root->right->right, 65);
+    other = binary_tree_node(NULL, 7);
+    binary_tree_print(root);
+
+    queries[0].first = root->left;
+    queries[0].second = root->right;
+    queries[1].first = root->right->left;
+    queries[1].second = root->right->right->right;
+    queries[2].first = root->right->right;
+    queries[2].second = root->right->right->right;
+    queries[3].first = root->left->left;
+    queries[3].second = root->left->left;
+    queries[4].first = root->left;
+    queries[4].second = other;
+    if (!binary_trees_ancestor_batch(root, queries, 5, out))
+        return (1);
+    for (i = 0; i < 5; i++)
+    {
+        printf("Ancestor of [%d] & [%d]: ", queries[i].first->n,
+               queries[i].second->n);
+        if (!out[i])
+            printf("(nil)\n");
+        else
+            printf("%d\n", out[i]->n);
+    }
+    binary_tree_delete(root);
+    binary_tree_delete(other);
+    return (0);
+}
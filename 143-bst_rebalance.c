@@ -0,0 +1,147 @@
+#include "binary_trees.h"
+
+/**
+ * bst_tree_to_vine - Straightens a BST into a right-leaning chain.
+ *
+ * @root: A pointer to the root node of the BST.
+ * @size: Address where the number of nodes is stored.
+ *
+ * Return: A pointer to the head of the chain (the smallest node).
+ *
+ * Description: Every node with a left child is rotated right until the
+ * chain below the current position has no left children. Each rotation
+ * moves one node onto the chain, so the pass costs O(n).
+ */
+bst_t *bst_tree_to_vine(bst_t *root, size_t *size)
+{
+	bst_t *node = root, *head = NULL;
+
+	*size = 0;
+	while (node != NULL)
+	{
+		if (node->left != NULL)
+			node = binary_tree_rotate_right(node);
+		else
+		{
+			if (head == NULL)
+				head = node;
+			(*size)++;
+			node = node->right;
+		}
+	}
+	return (head);
+}
+
+/**
+ * bst_vine_compress - Rotates every other node of a chain to the left.
+ *
+ * @head: A pointer to the head of the chain.
+ * @count: The number of left rotations to perform.
+ *
+ * Return: A pointer to the new head of the chain.
+ */
+bst_t *bst_vine_compress(bst_t *head, size_t count)
+{
+	bst_t *node = head, *pivot;
+	size_t i;
+
+	for (i = 0; i < count && node != NULL && node->right != NULL; i++)
+	{
+		pivot = binary_tree_rotate_left(node);
+		if (i == 0)
+			head = pivot;
+		node = pivot->right;
+	}
+	return (head);
+}
+
+/**
+ * bst_rebalance - Rebalances a BST in place (Day-Stout-Warren).
+ *
+ * @root: A pointer to the root node of the BST.
+ *
+ * Return: A pointer to the new root node.
+ *
+ * Description: The tree is first straightened into a chain, then folded
+ * back by rounds of left rotations into a tree whose levels are all full
+ * except the last one. Runs in O(n) time with O(1) extra space, using
+ * binary_tree_rotate_left/right so the parent pointers stay correct.
+ */
+bst_t *bst_rebalance(bst_t *root)
+{
+	size_t size, full;
+
+	if (root == NULL)
+		return (NULL);
+	root = bst_tree_to_vine(root, &size);
+	for (full = 1; full <= size + 1; full <<= 1)
+		;
+	full = (full >> 1) - 1;
+	root = bst_vine_compress(root, size - full);
+	while (full > 1)
+	{
+		full >>= 1;
+		root = bst_vine_compress(root, full);
+	}
+	return (root);
+}
+
+/**
+ * bst_measure - Counts the nodes of a tree and measures its height.
+ *
+ * @root: A pointer to the root node of the tree.
+ * @size: Address where the number of nodes is stored.
+ *
+ * Return: The height of the tree.
+ *
+ * Description: Walks the tree through the parent pointers so that long
+ * chains, the case that needs rebalancing, do not overflow the stack.
+ */
+size_t bst_measure(const bst_t *root, size_t *size)
+{
+	const bst_t *node = root, *prev = root->parent, *next;
+	size_t depth = 0, height = 0;
+
+	*size = 0;
+	while (node != root->parent)
+	{
+		if (prev == node->parent)
+			(*size)++;
+		if (prev == node->parent && (node->left || node->right))
+			next = node->left ? node->left : node->right;
+		else if (prev == node->left && node->right)
+			next = node->right;
+		else
+			next = node->parent;
+		if (next == node->parent)
+			depth--;
+		else if (++depth > height)
+			height = depth;
+		prev = node;
+		node = next;
+	}
+	return (height);
+}
+
+/**
+ * bst_rebalance_auto - Rebalances a BST when it has grown too deep.
+ *
+ * @root: A pointer to the root node of the BST.
+ * @factor: Allowed height as a multiple of log2(size).
+ *
+ * Return: A pointer to the root node, rebalanced if the height of the
+ *         tree exceeded @factor * log2(size).
+ */
+bst_t *bst_rebalance_auto(bst_t *root, double factor)
+{
+	size_t size, height, log2 = 0;
+
+	if (root == NULL)
+		return (NULL);
+	height = bst_measure(root, &size);
+	while (((size_t)1 << (log2 + 1)) <= size)
+		log2++;
+	if ((double)height > factor * (double)(log2 == 0 ? 1 : log2))
+		root = bst_rebalance(root);
+	return (root);
+}
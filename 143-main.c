@@ -0,0 +1,33 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *tree;
+    int array[] = {
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+        11, 12, 13, 14, 15, 16, 17, 18, 19, 20
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+
+    tree = array_to_bst(array, n);
+    if (!tree)
+        return (1);
+    printf("Height before: %lu\n", (unsigned long)binary_tree_height(tree));
+    tree = bst_rebalance_auto(tree, 2.0);
+    binary_tree_print(tree);
+    printf("Height after: %lu\n", (unsigned long)binary_tree_height(tree));
+    printf("Is BST: %d\n", binary_tree_is_bst(tree));
+    printf("Is root parent nil: %d\n", tree->parent == NULL);
+    tree = bst_rebalance_auto(tree, 2.0);
+    printf("Height after second call: %lu\n",
+           (unsigned long)binary_tree_height(tree));
+    binary_tree_delete(tree);
+    return (0);
+}
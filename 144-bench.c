@@ -0,0 +1,104 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/*
+ * gcc 144-bench.c 144-splay_tree.c 122-array_to_avl.c 121-avl_insert.c
+ *     149-bst_bulk.c 149-bulk_unique.c 153-avl_retrace.c 113-bst_search.c
+ *     103-binary_tree_rotate_left.c 104-binary_tree_rotate_right.c
+ *     3-binary_tree_delete.c 0-binary_tree_node.c -o 144-bench
+ */
+
+#define KEYS 20000
+#define LOOKUPS 4000000
+
+/**
+ * zipf_keys - Draws Zipf distributed lookups (s = 1) over a key set
+ *
+ * @keys: Keys ordered by decreasing popularity
+ * @n: Number of keys
+ * @out: Array receiving the lookups
+ * @count: Number of lookups to draw
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int zipf_keys(const int *keys, size_t n, int *out, size_t count)
+{
+    double *cdf, u;
+    size_t i, lo, hi, mid;
+
+    cdf = malloc(sizeof(*cdf) * n);
+    if (!cdf)
+        return (0);
+    for (i = 0; i < n; i++)
+        cdf[i] = (i ? cdf[i - 1] : 0) + 1.0 / (double)(i + 1);
+    for (i = 0; i < count; i++)
+    {
+        u = (double)rand() / RAND_MAX * cdf[n - 1];
+        for (lo = 0, hi = n - 1; lo < hi;)
+        {
+            mid = (lo + hi) / 2;
+            if (cdf[mid] < u)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        out[i] = keys[lo];
+    }
+    free(cdf);
+    return (1);
+}
+
+/**
+ * main - Benchmarks splay_search against bst_search on an AVL tree
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(void)
+{
+    int *keys, *lookups;
+    avl_t *avl;
+    bst_t *splay_root = NULL;
+    size_t i, j, found = 0;
+    int tmp;
+    clock_t start;
+
+    keys = malloc(sizeof(*keys) * KEYS);
+    lookups = malloc(sizeof(*lookups) * LOOKUPS);
+    if (!keys || !lookups)
+        return (1);
+    srand(42);
+    for (i = 0; i < KEYS; i++)
+        keys[i] = (int)i * 3;
+    for (i = KEYS - 1; i > 0; i--)
+    {
+        j = rand() % (i + 1);
+        tmp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = tmp;
+    }
+    avl = array_to_avl(keys, KEYS);
+    for (i = 0; i < KEYS; i++)
+        splay_insert(&splay_root, keys[i]);
+    if (!avl || !splay_root || !zipf_keys(keys, KEYS, lookups, LOOKUPS))
+        return (1);
+
+    start = clock();
+    for (i = 0; i < LOOKUPS; i++)
+        found += bst_search(avl, lookups[i]) != NULL;
+    printf("bst_search (AVL):  %.3fs\n",
+           (double)(clock() - start) / CLOCKS_PER_SEC);
+    start = clock();
+    for (i = 0; i < LOOKUPS; i++)
+        found += splay_search(&splay_root, lookups[i]) != NULL;
+    printf("splay_search:      %.3fs\n",
+           (double)(clock() - start) / CLOCKS_PER_SEC);
+    printf("%lu keys, %lu Zipf lookups, %lu hits\n", (unsigned long)KEYS,
+           (unsigned long)LOOKUPS, (unsigned long)found);
+    binary_tree_delete(avl);
+    binary_tree_delete(splay_root);
+    free(keys);
+    free(lookups);
+    return (0);
+}
@@ -0,0 +1,43 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *root;
+    bst_t *node;
+
+    root = NULL;
+    splay_insert(&root, 98);
+    splay_insert(&root, 402);
+    splay_insert(&root, 12);
+    splay_insert(&root, 46);
+    splay_insert(&root, 128);
+    splay_insert(&root, 256);
+    splay_insert(&root, 512);
+    splay_insert(&root, 1);
+    node = splay_insert(&root, 128);
+    printf("Node should be nil -> %p\n", (void *)node);
+    binary_tree_print(root);
+
+    node = splay_search(&root, 46);
+    printf("Found: %d, root: %d\n", node->n, root->n);
+    binary_tree_print(root);
+    node = splay_search(&root, 100);
+    printf("Found: %p, root: %d\n", (void *)node, root->n);
+
+    root = splay_remove(root, 46);
+    printf("Removed 46...\n");
+    binary_tree_print(root);
+    root = splay_remove(root, 1);
+    printf("Removed 1...\n");
+    binary_tree_print(root);
+    printf("Is BST: %d\n", binary_tree_is_bst(root));
+    binary_tree_delete(root);
+    return (0);
+}
@@ -0,0 +1,152 @@
+#include "binary_trees.h"
+
+/**
+ * splay - Moves a node to the root of its tree.
+ *
+ * @node: A pointer to the node to splay.
+ *
+ * Return: A pointer to @node, now the root of the tree.
+ *
+ * Description: Bottom-up splaying through binary_tree_rotate_left and
+ * binary_tree_rotate_right. A node and its parent on the same side of
+ * the grandparent (zig-zig) rotate the grandparent first; on opposite
+ * sides (zig-zag) the parent is rotated first. Both halve the depth of
+ * the nodes along the access path.
+ */
+bst_t *splay(bst_t *node)
+{
+	bst_t *parent, *grand;
+	int zigzig;
+
+	while (node != NULL && node->parent != NULL)
+	{
+		parent = node->parent;
+		grand = parent->parent;
+		zigzig = grand != NULL &&
+			(parent->left == node) == (grand->left == parent);
+		if (zigzig)
+		{
+			if (parent->left == node)
+				binary_tree_rotate_right(grand);
+			else
+				binary_tree_rotate_left(grand);
+		}
+		else if (grand != NULL)
+		{
+			if (parent->left == node)
+				binary_tree_rotate_right(parent);
+			else
+				binary_tree_rotate_left(parent);
+			parent = node->parent;
+		}
+		if (parent->left == node)
+			binary_tree_rotate_right(parent);
+		else
+			binary_tree_rotate_left(parent);
+	}
+	return (node);
+}
+
+/**
+ * splay_search - Searches for a value in a splay tree.
+ *
+ * @tree: A double pointer to the root node of the splay tree.
+ * @value: The value to search for.
+ *
+ * Return: A pointer to the node holding @value, or NULL if not found.
+ *
+ * Description: The node found, or the last node visited when @value is
+ * missing, is splayed to the root and *@tree is updated, so keys that
+ * are accessed often stay near the top.
+ */
+bst_t *splay_search(bst_t **tree, int value)
+{
+	bst_t *node, *last = NULL;
+
+	if (tree == NULL || *tree == NULL)
+		return (NULL);
+	node = *tree;
+	while (node != NULL && node->n != value)
+	{
+		last = node;
+		node = value < node->n ? node->left : node->right;
+	}
+	*tree = splay(node != NULL ? node : last);
+	return (node);
+}
+
+/**
+ * splay_insert - Inserts a value into a splay tree.
+ *
+ * @tree: A double pointer to the root node of the splay tree.
+ * @value: The value to insert.
+ *
+ * Return: A pointer to the created node, now the root of the tree,
+ *         or NULL on failure or if @value is already present (the
+ *         existing node is then splayed to the root).
+ */
+bst_t *splay_insert(bst_t **tree, int value)
+{
+	bst_t *node, *parent = NULL;
+
+	if (tree == NULL)
+		return (NULL);
+	node = *tree;
+	while (node != NULL)
+	{
+		if (node->n == value)
+		{
+			*tree = splay(node);
+			return (NULL);
+		}
+		parent = node;
+		node = value < node->n ? node->left : node->right;
+	}
+	node = binary_tree_node(parent, value);
+	if (node == NULL)
+		return (NULL);
+	if (parent == NULL)
+		return (*tree = node);
+	if (value < parent->n)
+		parent->left = node;
+	else
+		parent->right = node;
+	*tree = splay(node);
+	return (node);
+}
+
+/**
+ * splay_remove - Removes a value from a splay tree.
+ *
+ * @root: A pointer to the root node of the splay tree.
+ * @value: The value to remove.
+ *
+ * Return: A pointer to the new root node after removal.
+ *
+ * Description: The node is splayed to the root and removed; the largest
+ * node of its left subtree is then splayed to the top of that subtree,
+ * where it has no right child, and the right subtree is hung there.
+ */
+bst_t *splay_remove(bst_t *root, int value)
+{
+	bst_t *node, *left, *right, *max;
+
+	node = splay_search(&root, value);
+	if (node == NULL)
+		return (root);
+	left = node->left;
+	right = node->right;
+	free(node);
+	if (right != NULL)
+		right->parent = NULL;
+	if (left == NULL)
+		return (right);
+	left->parent = NULL;
+	for (max = left; max->right != NULL;)
+		max = max->right;
+	left = splay(max);
+	left->right = right;
+	if (right != NULL)
+		right->parent = left;
+	return (left);
+}
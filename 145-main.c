@@ -0,0 +1,36 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *root, *lo, *hi;
+    int i;
+
+    srand(98);
+    root = NULL;
+    for (i = 1; i <= 20; i++)
+        treap_insert(&root, i * 10);
+    binary_tree_print(root);
+    printf("Height: %lu\n", (unsigned long)binary_tree_height(root));
+
+    treap_split(root, 105, &lo, &hi);
+    printf("Lower shard:\n");
+    binary_tree_print(lo);
+    printf("Upper shard:\n");
+    binary_tree_print(hi);
+
+    root = treap_merge(lo, hi);
+    root = treap_remove(root, 100);
+    root = treap_remove(root, 10);
+    printf("Merged, without 10 and 100:\n");
+    binary_tree_print(root);
+    printf("Is BST: %d\n", binary_tree_is_bst(root));
+    binary_tree_delete(root);
+    return (0);
+}
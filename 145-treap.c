@@ -0,0 +1,156 @@
+#include "binary_trees.h"
+
+/**
+ * treap_insert - Inserts a value into a treap.
+ *
+ * @tree: A double pointer to the root node of the treap.
+ * @value: The value to insert.
+ *
+ * Return: A pointer to the created node, or NULL on failure or if
+ *         @value is already present.
+ *
+ * Description: The value is inserted as in bst_insert with a random
+ * priority in the node's meta field, then rotated up while its priority
+ * beats its parent's. The shape is that of a BST built in random order,
+ * so the expected height is O(log n) whatever the insertion order.
+ */
+bst_t *treap_insert(bst_t **tree, int value)
+{
+	bst_t *node, *parent = NULL;
+
+	if (tree == NULL)
+		return (NULL);
+	for (node = *tree; node != NULL;)
+	{
+		if (node->n == value)
+			return (NULL);
+		parent = node;
+		node = value < node->n ? node->left : node->right;
+	}
+	node = binary_tree_node(parent, value);
+	if (node == NULL)
+		return (NULL);
+	node->meta = rand();
+	if (parent == NULL)
+		return (*tree = node);
+	if (value < parent->n)
+		parent->left = node;
+	else
+		parent->right = node;
+	while (node->parent != NULL && node->meta > node->parent->meta)
+	{
+		if (node->parent->left == node)
+			binary_tree_rotate_right(node->parent);
+		else
+			binary_tree_rotate_left(node->parent);
+	}
+	if (node->parent == NULL)
+		*tree = node;
+	return (node);
+}
+
+/**
+ * treap_split - Splits a treap around a key.
+ *
+ * @root: A pointer to the root node of the treap to split.
+ * @key: The splitting key.
+ * @lo: Address where the treap of the values lower than @key is stored.
+ * @hi: Address where the treap of the other values is stored.
+ *
+ * Description: Follows the search path of @key, handing each node to
+ * the side it belongs to, in expected O(log n). @root is consumed.
+ */
+void treap_split(bst_t *root, int key, bst_t **lo, bst_t **hi)
+{
+	bst_t *sub;
+
+	if (root == NULL)
+	{
+		*lo = NULL;
+		*hi = NULL;
+		return;
+	}
+	root->parent = NULL;
+	if (root->n < key)
+	{
+		treap_split(root->right, key, &sub, hi);
+		root->right = sub;
+		*lo = root;
+	}
+	else
+	{
+		treap_split(root->left, key, lo, &sub);
+		root->left = sub;
+		*hi = root;
+	}
+	if (sub != NULL)
+		sub->parent = root;
+}
+
+/**
+ * treap_merge - Joins two treaps.
+ *
+ * @lo: A pointer to the root node of the first treap.
+ * @hi: A pointer to the root node of the second treap, whose values must
+ * all be greater than those of @lo.
+ *
+ * Return: A pointer to the root node of the joined treap.
+ *
+ * Description: Walks down the right spine of @lo and the left spine of
+ * @hi, interleaving them by priority, in expected O(log n). Both treaps
+ * are consumed.
+ */
+bst_t *treap_merge(bst_t *lo, bst_t *hi)
+{
+	bst_t *root;
+
+	if (lo == NULL || hi == NULL)
+		root = lo != NULL ? lo : hi;
+	else if (lo->meta > hi->meta)
+	{
+		lo->right = treap_merge(lo->right, hi);
+		lo->right->parent = lo;
+		root = lo;
+	}
+	else
+	{
+		hi->left = treap_merge(lo, hi->left);
+		hi->left->parent = hi;
+		root = hi;
+	}
+	if (root != NULL)
+		root->parent = NULL;
+	return (root);
+}
+
+/**
+ * treap_remove - Removes a value from a treap.
+ *
+ * @root: A pointer to the root node of the treap.
+ * @value: The value to remove.
+ *
+ * Return: A pointer to the new root node after removal.
+ *
+ * Description: The two subtrees of the removed node are merged and put
+ * in its place.
+ */
+bst_t *treap_remove(bst_t *root, int value)
+{
+	bst_t *node, *parent, *sub;
+
+	node = bst_search(root, value);
+	if (node == NULL)
+		return (root);
+	parent = node->parent;
+	sub = treap_merge(node->left, node->right);
+	if (sub != NULL)
+		sub->parent = parent;
+	if (parent == NULL)
+		root = sub;
+	else if (parent->left == node)
+		parent->left = sub;
+	else
+		parent->right = sub;
+	free(node);
+	return (root);
+}
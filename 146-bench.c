@@ -0,0 +1,90 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/*
+ * gcc 146-bench.c 146-rb_tree.c 146-rb_remove.c 121-avl_insert.c
+ *     123-avl_remove.c 153-avl_retrace.c 103-binary_tree_rotate_left.c
+ *     104-binary_tree_rotate_right.c 0-binary_tree_node.c -o 146-bench
+ */
+
+#define KEYS 2000
+#define OPS 20000
+
+/**
+ * make_ops - Draws a 50/50 mix of insertions of absent keys and
+ * removals of present keys
+ *
+ * @ops: Array receiving the keys, negative for removals
+ * @count: Number of operations
+ * @present: Presence flag of every key, updated as the ops are drawn
+ */
+void make_ops(int *ops, size_t count, char *present)
+{
+    size_t i;
+    int key;
+
+    for (i = 0; i < count; i++)
+    {
+        do {
+            key = 1 + rand() % (2 * KEYS);
+        } while (present[key] != (char)(i % 2));
+        present[key] = !present[key];
+        ops[i] = i % 2 ? -key : key;
+    }
+}
+
+/**
+ * main - Benchmarks rb_insert/rb_remove against avl_insert/avl_remove
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(void)
+{
+    int *ops;
+    char *present;
+    bst_t *rb = NULL;
+    avl_t *avl = NULL;
+    size_t i;
+    clock_t start;
+
+    ops = malloc(sizeof(*ops) * OPS);
+    present = calloc(2 * KEYS + 1, 1);
+    if (!ops || !present)
+        return (1);
+    srand(42);
+    for (i = 0; i < KEYS; i++)
+    {
+        avl_insert(&avl, 2 * i + 1);
+        rb_insert(&rb, 2 * i + 1);
+        present[2 * i + 1] = 1;
+    }
+    make_ops(ops, OPS, present);
+
+    start = clock();
+    for (i = 0; i < OPS; i++)
+    {
+        if (ops[i] > 0)
+            avl_insert(&avl, ops[i]);
+        else
+            avl = avl_remove(avl, -ops[i]);
+    }
+    printf("avl_insert/avl_remove: %.3fs\n",
+           (double)(clock() - start) / CLOCKS_PER_SEC);
+    start = clock();
+    for (i = 0; i < OPS; i++)
+    {
+        if (ops[i] > 0)
+            rb_insert(&rb, ops[i]);
+        else
+            rb = rb_remove(rb, -ops[i]);
+    }
+    printf("rb_insert/rb_remove:   %.3fs\n",
+           (double)(clock() - start) / CLOCKS_PER_SEC);
+    printf("%lu operations on about %lu keys\n", (unsigned long)OPS,
+           (unsigned long)KEYS);
+    free(ops);
+    free(present);
+    return (0);
+}
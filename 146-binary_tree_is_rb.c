@@ -0,0 +1,57 @@
+#include "binary_trees.h"
+#include "limits.h"
+
+/**
+ * rb_black_height - Checks a red-black subtree and measures its black
+ * height.
+ *
+ * @tree: A pointer to the root node of the subtree to check.
+ * @lo: The smallest value allowed in the subtree.
+ * @hi: The largest value allowed in the subtree.
+ *
+ * Return: The number of black nodes on every path down to a leaf,
+ *         or -1 if the subtree breaks a red-black rule.
+ *
+ * Description: The bounds are long so that the bounds of the children
+ * of INT_MIN and INT_MAX do not overflow.
+ */
+int rb_black_height(const binary_tree_t *tree, long lo, long hi)
+{
+	int left, right;
+
+	if (tree == NULL)
+		return (0);
+	if (tree->n < lo || tree->n > hi)
+		return (-1);
+	if (tree->meta != RB_RED && tree->meta != RB_BLACK)
+		return (-1);
+	if (tree->meta == RB_RED && tree->parent &&
+			tree->parent->meta == RB_RED)
+		return (-1);
+	if ((tree->left && tree->left->parent != tree) ||
+			(tree->right && tree->right->parent != tree))
+		return (-1);
+	left = rb_black_height(tree->left, lo, (long)tree->n - 1);
+	right = rb_black_height(tree->right, (long)tree->n + 1, hi);
+	if (left < 0 || right < 0 || left != right)
+		return (-1);
+	return (left + (tree->meta == RB_BLACK));
+}
+
+/**
+ * binary_tree_is_rb - Checks if a binary tree is a valid red-black tree.
+ *
+ * @tree: A pointer to the root node of the tree to check.
+ *
+ * Return: 1 if the tree is a valid red-black tree, 0 otherwise.
+ *
+ * Description: The tree must be a BST with a black root, no red node
+ * may have a red parent, and every path from a node down to its leaves
+ * must go through the same number of black nodes.
+ */
+int binary_tree_is_rb(const binary_tree_t *tree)
+{
+	if (tree == NULL || tree->meta != RB_BLACK)
+		return (0);
+	return (rb_black_height(tree, INT_MIN, INT_MAX) >= 0);
+}
@@ -0,0 +1,39 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *root;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    root = NULL;
+    for (i = 0; i < n; i++)
+        rb_insert(&root, array[i]);
+    binary_tree_print(root);
+    printf("Is RB: %d\n", binary_tree_is_rb(root));
+    printf("Found: %d\n", rb_search(root, 62)->n);
+
+    root = rb_remove(root, 47);
+    printf("Removed 47...\n");
+    binary_tree_print(root);
+    root = rb_remove(root, 79);
+    printf("Removed 79...\n");
+    binary_tree_print(root);
+    root = rb_remove(root, 32);
+    printf("Removed 32...\n");
+    binary_tree_print(root);
+    printf("Is RB: %d\n", binary_tree_is_rb(root));
+    binary_tree_delete(root);
+    return (0);
+}
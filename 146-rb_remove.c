@@ -0,0 +1,114 @@
+#include "binary_trees.h"
+
+/**
+ * rb_is_black - Tells whether a red-black node is black.
+ *
+ * @node: The node, NULL leaves count as black.
+ *
+ * Return: 1 if @node is black, 0 if it is red.
+ */
+int rb_is_black(const bst_t *node)
+{
+	return (node == NULL || node->meta == RB_BLACK);
+}
+
+/**
+ * rb_remove_fixup - Restores the red-black rules after removing a black
+ * node.
+ *
+ * @root: A pointer to the root node of the tree.
+ * @node: The node that took the removed node's place (may be NULL).
+ * @parent: The parent of @node.
+ *
+ * Return: A pointer to the root node of the tree.
+ *
+ * Description: @node carries an extra black. A red sibling is rotated
+ * up first; a black sibling with black children is recolored and the
+ * extra black moves up; otherwise one or two rotations absorb it. At
+ * most three rotations are performed in total.
+ */
+bst_t *rb_remove_fixup(bst_t *root, bst_t *node, bst_t *parent)
+{
+	bst_t *sibling, *near, *far;
+	int left;
+
+	while (node != root && rb_is_black(node))
+	{
+		left = parent->left == node;
+		sibling = left ? parent->right : parent->left;
+		if (!rb_is_black(sibling))
+		{
+			sibling->meta = RB_BLACK;
+			parent->meta = RB_RED;
+			root = rb_rotate(root, parent, left);
+			sibling = left ? parent->right : parent->left;
+		}
+		near = left ? sibling->left : sibling->right;
+		far = left ? sibling->right : sibling->left;
+		if (rb_is_black(near) && rb_is_black(far))
+		{
+			sibling->meta = RB_RED;
+			node = parent;
+			parent = node->parent;
+			continue;
+		}
+		if (rb_is_black(far))
+		{
+			near->meta = RB_BLACK;
+			sibling->meta = RB_RED;
+			root = rb_rotate(root, sibling, !left);
+			sibling = left ? parent->right : parent->left;
+			far = left ? sibling->right : sibling->left;
+		}
+		sibling->meta = parent->meta;
+		parent->meta = RB_BLACK;
+		far->meta = RB_BLACK;
+		root = rb_rotate(root, parent, left);
+		node = root;
+	}
+	if (node != NULL)
+		node->meta = RB_BLACK;
+	return (root);
+}
+
+/**
+ * rb_remove - Removes a value from a red-black tree.
+ *
+ * @root: A pointer to the root node of the red-black tree.
+ * @value: The value to remove.
+ *
+ * Return: A pointer to the new root node after removal.
+ *
+ * Description: A node with two children takes the value of its in-order
+ * successor, which is unlinked instead. Removing a black node hands an
+ * extra black to the child that replaces it.
+ */
+bst_t *rb_remove(bst_t *root, int value)
+{
+	bst_t *node, *child, *parent;
+
+	node = rb_search(root, value);
+	if (node == NULL)
+		return (root);
+	if (node->left != NULL && node->right != NULL)
+	{
+		for (child = node->right; child->left != NULL;)
+			child = child->left;
+		node->n = child->n;
+		node = child;
+	}
+	child = node->left != NULL ? node->left : node->right;
+	parent = node->parent;
+	if (child != NULL)
+		child->parent = parent;
+	if (parent == NULL)
+		root = child;
+	else if (parent->left == node)
+		parent->left = child;
+	else
+		parent->right = child;
+	if (node->meta == RB_BLACK)
+		root = rb_remove_fixup(root, child, parent);
+	free(node);
+	return (root);
+}
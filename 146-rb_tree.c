@@ -0,0 +1,121 @@
+#include "binary_trees.h"
+
+/**
+ * rb_rotate - Rotates a red-black subtree and keeps track of the root.
+ *
+ * @root: A pointer to the root node of the whole tree.
+ * @node: The node to rotate.
+ * @left: 1 for a left rotation, 0 for a right rotation.
+ *
+ * Return: A pointer to the root node of the whole tree after rotation.
+ */
+bst_t *rb_rotate(bst_t *root, bst_t *node, int left)
+{
+	bst_t *pivot;
+
+	if (left)
+		pivot = binary_tree_rotate_left(node);
+	else
+		pivot = binary_tree_rotate_right(node);
+	if (pivot != NULL && pivot->parent == NULL)
+		root = pivot;
+	return (root);
+}
+
+/**
+ * rb_insert_fixup - Restores the red-black rules after an insertion.
+ *
+ * @root: A pointer to the root node of the tree.
+ * @node: The newly inserted (red) node.
+ *
+ * Return: A pointer to the root node of the tree.
+ *
+ * Description: A red uncle is recolored and the check moves up two
+ * levels; a black uncle ends the fixup with one or two rotations.
+ */
+bst_t *rb_insert_fixup(bst_t *root, bst_t *node)
+{
+	bst_t *parent, *grand, *uncle;
+	int left;
+
+	while ((parent = node->parent) != NULL && parent->meta == RB_RED)
+	{
+		grand = parent->parent;
+		left = grand->left == parent;
+		uncle = left ? grand->right : grand->left;
+		if (uncle != NULL && uncle->meta == RB_RED)
+		{
+			parent->meta = RB_BLACK;
+			uncle->meta = RB_BLACK;
+			grand->meta = RB_RED;
+			node = grand;
+			continue;
+		}
+		if (node == (left ? parent->right : parent->left))
+		{
+			root = rb_rotate(root, parent, left);
+			node = parent;
+			parent = node->parent;
+		}
+		parent->meta = RB_BLACK;
+		grand->meta = RB_RED;
+		root = rb_rotate(root, grand, !left);
+	}
+	root->meta = RB_BLACK;
+	return (root);
+}
+
+/**
+ * rb_insert - Inserts a value into a red-black tree.
+ *
+ * @tree: A double pointer to the root node of the red-black tree.
+ * @value: The value to insert.
+ *
+ * Return: A pointer to the created node, or NULL on failure or if
+ *         @value is already present.
+ *
+ * Description: The color lives in the meta field of the node
+ * (RB_RED, the default of binary_tree_node, or RB_BLACK). An insertion
+ * performs at most two rotations.
+ */
+bst_t *rb_insert(bst_t **tree, int value)
+{
+	bst_t *node, *parent = NULL;
+
+	if (tree == NULL)
+		return (NULL);
+	for (node = *tree; node != NULL;)
+	{
+		if (node->n == value)
+			return (NULL);
+		parent = node;
+		node = value < node->n ? node->left : node->right;
+	}
+	node = binary_tree_node(parent, value);
+	if (node == NULL)
+		return (NULL);
+	node->meta = RB_RED;
+	if (parent == NULL)
+		*tree = node;
+	else if (value < parent->n)
+		parent->left = node;
+	else
+		parent->right = node;
+	*tree = rb_insert_fixup(*tree, node);
+	return (node);
+}
+
+/**
+ * rb_search - Searches for a value in a red-black tree.
+ *
+ * @tree: A pointer to the root node of the red-black tree.
+ * @value: The value to search for.
+ *
+ * Return: A pointer to the node holding @value, or NULL if not found.
+ */
+bst_t *rb_search(const bst_t *tree, int value)
+{
+	while (tree != NULL && tree->n != value)
+		tree = value < tree->n ? tree->left : tree->right;
+	return ((bst_t *)tree);
+}
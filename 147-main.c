@@ -0,0 +1,36 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    scapegoat_t *tree;
+    int i;
+
+    tree = scapegoat_create(0.6);
+    if (!tree)
+        return (1);
+    for (i = 1; i <= 20; i++)
+        scapegoat_insert(tree, i * 10);
+    binary_tree_print(tree->root);
+    printf("Height: %lu\n", (unsigned long)binary_tree_height(tree->root));
+
+    for (i = 1; i <= 8; i++)
+        scapegoat_remove(tree, i * 10);
+    printf("Removed 10 to 80...\n");
+    binary_tree_print(tree->root);
+
+    scapegoat_set_alpha(tree, 0.75);
+    for (i = 21; i <= 30; i++)
+        scapegoat_insert(tree, i * 10);
+    printf("Inserted 210 to 300 with alpha 0.75...\n");
+    binary_tree_print(tree->root);
+    printf("Is BST: %d\n", binary_tree_is_bst(tree->root));
+    scapegoat_delete(tree);
+    return (0);
+}
@@ -0,0 +1,130 @@
+#include "binary_trees.h"
+
+/**
+ * scapegoat_create - Creates an empty scapegoat tree.
+ *
+ * @alpha: Balance factor, strictly between 0.5 and 1. A subtree is
+ * rebuilt when one of its children holds more than @alpha of its nodes;
+ * lower values keep the tree shallower at the cost of more rebuilds.
+ *
+ * Return: A pointer to the new tree, or NULL on failure.
+ */
+scapegoat_t *scapegoat_create(double alpha)
+{
+	scapegoat_t *tree;
+
+	if (!(alpha > 0.5 && alpha < 1.0))
+		return (NULL);
+	tree = malloc(sizeof(*tree));
+	if (tree == NULL)
+		return (NULL);
+	tree->root = NULL;
+	tree->size = 0;
+	tree->max_size = 0;
+	tree->alpha = alpha;
+	return (tree);
+}
+
+/**
+ * scapegoat_set_alpha - Changes the balance factor of a scapegoat tree.
+ *
+ * @tree: A pointer to the scapegoat tree.
+ * @alpha: New balance factor, strictly between 0.5 and 1.
+ *
+ * Return: 1 on success, 0 if @alpha is out of range or the tree could
+ *         not be rebuilt (the tree and its factor are then kept).
+ *
+ * Description: A higher factor only loosens the height bound, so it
+ * applies from the next update on. A lower one rebuilds the whole tree
+ * once in O(n), so the tighter bound log(size) / log(1 / alpha) holds
+ * right away instead of only after enough updates.
+ */
+int scapegoat_set_alpha(scapegoat_t *tree, double alpha)
+{
+	if (tree == NULL || !(alpha > 0.5 && alpha < 1.0))
+		return (0);
+	if (alpha < tree->alpha)
+	{
+		if (!scapegoat_rebuild(tree, tree->root))
+			return (0);
+		tree->max_size = tree->size;
+	}
+	tree->alpha = alpha;
+	return (1);
+}
+
+/**
+ * scapegoat_delete - Frees a scapegoat tree and all its nodes.
+ *
+ * @tree: A pointer to the scapegoat tree.
+ */
+void scapegoat_delete(scapegoat_t *tree)
+{
+	if (tree == NULL)
+		return;
+	binary_tree_delete(tree->root);
+	free(tree);
+}
+
+/**
+ * scapegoat_insert - Inserts a value into a scapegoat tree.
+ *
+ * @tree: A pointer to the scapegoat tree.
+ * @value: The value to insert.
+ *
+ * Return: A pointer to the node holding @value, or NULL on failure or if
+ *         @value is already present.
+ *
+ * Description: The value is inserted with bst_insert. When the new node
+ * lands deeper than log(size) / log(1 / alpha), the lowest ancestor
+ * whose child holds more than alpha of its nodes is rebuilt into a
+ * perfectly balanced subtree. Updates cost O(log n) amortized.
+ */
+bst_t *scapegoat_insert(scapegoat_t *tree, int value)
+{
+	bst_t *node, *walk;
+	size_t depth = 0;
+
+	if (tree == NULL)
+		return (NULL);
+	node = bst_insert(&tree->root, value);
+	if (node == NULL)
+		return (NULL);
+	tree->size++;
+	if (tree->size > tree->max_size)
+		tree->max_size = tree->size;
+	for (walk = node; walk->parent != NULL; walk = walk->parent)
+		depth++;
+	if (depth > scapegoat_depth_limit(tree->size, tree->alpha))
+	{
+		scapegoat_rebuild(tree, scapegoat_find(node, tree->alpha));
+		node = bst_search(tree->root, value);
+	}
+	return (node);
+}
+
+/**
+ * scapegoat_remove - Removes a value from a scapegoat tree.
+ *
+ * @tree: A pointer to the scapegoat tree.
+ * @value: The value to remove.
+ *
+ * Return: 1 if @value was removed, 0 if it was not found.
+ *
+ * Description: The value is removed with bst_remove. Once the tree has
+ * shrunk below alpha times its largest size since the last full
+ * rebuild, the whole tree is rebuilt.
+ */
+int scapegoat_remove(scapegoat_t *tree, int value)
+{
+	if (tree == NULL || bst_search(tree->root, value) == NULL)
+		return (0);
+	tree->root = bst_remove(tree->root, value);
+	tree->size--;
+	if ((double)tree->size < tree->alpha * (double)tree->max_size)
+	{
+		scapegoat_rebuild(tree, tree->root);
+		tree->max_size = tree->size;
+	}
+	return (1);
+}
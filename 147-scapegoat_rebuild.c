@@ -0,0 +1,110 @@
+#include "binary_trees.h"
+
+/**
+ * scapegoat_depth_limit - Computes the deepest depth allowed in a
+ * scapegoat tree.
+ *
+ * @size: The number of nodes in the tree.
+ * @alpha: The balance factor of the tree.
+ *
+ * Return: floor(log(size) / log(1 / alpha)).
+ */
+size_t scapegoat_depth_limit(size_t size, double alpha)
+{
+	double reach = 1.0;
+	size_t limit = 0;
+
+	while (reach / alpha <= (double)size)
+	{
+		reach /= alpha;
+		limit++;
+	}
+	return (limit);
+}
+
+/**
+ * scapegoat_find - Finds the subtree to rebuild after a deep insertion.
+ *
+ * @node: The node that was inserted too deep.
+ * @alpha: The balance factor of the tree.
+ *
+ * Return: The lowest ancestor of @node with a child holding more than
+ *         @alpha of its nodes, or the root if there is none.
+ *
+ * Description: Climbs from @node, adding the size of each sibling
+ * subtree to get the size of the next ancestor.
+ */
+bst_t *scapegoat_find(bst_t *node, double alpha)
+{
+	bst_t *parent, *sibling;
+	size_t size = 1, parent_size;
+
+	while (node->parent != NULL)
+	{
+		parent = node->parent;
+		sibling = parent->left == node ? parent->right : parent->left;
+		parent_size = size + binary_tree_size(sibling) + 1;
+		if ((double)size > alpha * (double)parent_size)
+			return (parent);
+		node = parent;
+		size = parent_size;
+	}
+	return (node);
+}
+
+/**
+ * scapegoat_flatten - Stores the values of a subtree in order.
+ *
+ * @tree: A pointer to the root node of the subtree.
+ * @array: Array receiving the values.
+ * @i: Position of the next free entry of @array.
+ */
+void scapegoat_flatten(const bst_t *tree, int *array, size_t *i)
+{
+	if (tree == NULL)
+		return;
+	scapegoat_flatten(tree->left, array, i);
+	array[(*i)++] = tree->n;
+	scapegoat_flatten(tree->right, array, i);
+}
+
+/**
+ * scapegoat_rebuild - Rebuilds a subtree into a perfectly balanced one.
+ *
+ * @tree: A pointer to the scapegoat tree.
+ * @node: The root node of the subtree to rebuild.
+ *
+ * Return: 1 on success, 0 on allocation failure (the subtree is kept).
+ *
+ * Description: The values are dumped in order and the subtree is rebuilt
+ * by sorted_array_to_avl, which always roots each range at its middle.
+ */
+int scapegoat_rebuild(scapegoat_t *tree, bst_t *node)
+{
+	bst_t *parent, *sub;
+	size_t size, i = 0;
+	int *values, left;
+
+	if (node == NULL)
+		return (1);
+	size = binary_tree_size(node);
+	values = malloc(sizeof(*values) * size);
+	if (values == NULL)
+		return (0);
+	scapegoat_flatten(node, values, &i);
+	sub = sorted_array_to_avl(values, size);
+	free(values);
+	if (sub == NULL)
+		return (0);
+	parent = node->parent;
+	left = parent != NULL && parent->left == node;
+	binary_tree_delete(node);
+	sub->parent = parent;
+	if (parent == NULL)
+		tree->root = sub;
+	else if (left)
+		parent->left = sub;
+	else
+		parent->right = sub;
+	return (1);
+}
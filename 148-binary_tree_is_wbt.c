@@ -0,0 +1,52 @@
+#include "binary_trees.h"
+#include "limits.h"
+
+/**
+ * wbt_check - Checks a weight-balanced subtree and measures its size.
+ *
+ * @tree: A pointer to the root node of the subtree to check.
+ * @lo: The smallest value allowed in the subtree.
+ * @hi: The largest value allowed in the subtree.
+ *
+ * Return: The number of nodes in the subtree, or -1 if the subtree
+ *         breaks a weight-balanced tree rule.
+ */
+long wbt_check(const binary_tree_t *tree, long lo, long hi)
+{
+	long left, right;
+
+	if (tree == NULL)
+		return (0);
+	if (tree->n < lo || tree->n > hi)
+		return (-1);
+	if ((tree->left && tree->left->parent != tree) ||
+			(tree->right && tree->right->parent != tree))
+		return (-1);
+	left = wbt_check(tree->left, lo, (long)tree->n - 1);
+	right = wbt_check(tree->right, (long)tree->n + 1, hi);
+	if (left < 0 || right < 0 || tree->meta != left + right + 1)
+		return (-1);
+	if (left + right > 1 &&
+			(left > WBT_DELTA * right || right > WBT_DELTA * left))
+		return (-1);
+	return (left + right + 1);
+}
+
+/**
+ * binary_tree_is_wbt - Checks if a binary tree is a valid weight-balanced
+ * tree.
+ *
+ * @tree: A pointer to the root node of the tree to check.
+ *
+ * Return: 1 if the tree is a valid weight-balanced tree, 0 otherwise.
+ *
+ * Description: The tree must be a BST whose meta fields hold the
+ * subtree sizes, and no subtree of more than one node may be more than
+ * WBT_DELTA times heavier than its sibling.
+ */
+int binary_tree_is_wbt(const binary_tree_t *tree)
+{
+	if (tree == NULL || tree->parent != NULL)
+		return (0);
+	return (wbt_check(tree, INT_MIN, INT_MAX) >= 0);
+}
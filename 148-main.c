@@ -0,0 +1,48 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *evens, *thirds, *a, *b;
+    int i;
+
+    evens = NULL;
+    thirds = NULL;
+    for (i = 1; i <= 12; i++)
+    {
+        wbt_insert(&evens, i * 2);
+        wbt_insert(&thirds, i * 3);
+    }
+    printf("Evens:\n");
+    binary_tree_print(evens);
+    printf("Multiples of 3:\n");
+    binary_tree_print(thirds);
+
+    a = wbt_union(evens, thirds);
+    printf("Union (%lu nodes), is WBT: %d\n",
+           (unsigned long)binary_tree_size(a), binary_tree_is_wbt(a));
+    binary_tree_print(a);
+
+    b = NULL;
+    for (i = 0; i <= 36; i += 4)
+        wbt_insert(&b, i);
+    a = wbt_difference(a, b);
+    printf("Without multiples of 4, is WBT: %d\n", binary_tree_is_wbt(a));
+    binary_tree_print(a);
+
+    b = NULL;
+    for (i = 0; i <= 36; i += 9)
+        wbt_insert(&b, i);
+    a = wbt_intersection(a, b);
+    a = wbt_remove(a, 27);
+    printf("Intersection with multiples of 9, without 27:\n");
+    binary_tree_print(a);
+    binary_tree_delete(a);
+    return (0);
+}
@@ -0,0 +1,95 @@
+#include "binary_trees.h"
+
+/**
+ * wbt_insert - Inserts a value into a weight-balanced tree.
+ *
+ * @tree: A double pointer to the root node of the tree.
+ * @value: The value to insert.
+ *
+ * Return: A pointer to the created node, or NULL on failure or if
+ *         @value is already present.
+ *
+ * Description: The tree is split around @value and joined back with the
+ * new node in the middle, in O(log n).
+ */
+bst_t *wbt_insert(bst_t **tree, int value)
+{
+	bst_t *node, *lo, *hi, *found;
+
+	if (tree == NULL)
+		return (NULL);
+	node = binary_tree_node(NULL, value);
+	if (node == NULL)
+		return (NULL);
+	found = wbt_split(*tree, value, &lo, &hi);
+	if (found != NULL)
+	{
+		free(node);
+		*tree = wbt_join(lo, found, hi);
+		return (NULL);
+	}
+	*tree = wbt_join(lo, node, hi);
+	return (node);
+}
+
+/**
+ * wbt_remove - Removes a value from a weight-balanced tree.
+ *
+ * @root: A pointer to the root node of the tree.
+ * @value: The value to remove.
+ *
+ * Return: A pointer to the new root node of the tree.
+ */
+bst_t *wbt_remove(bst_t *root, int value)
+{
+	bst_t *lo, *hi;
+
+	free(wbt_split(root, value, &lo, &hi));
+	return (wbt_join2(lo, hi));
+}
+
+/**
+ * wbt_union - Merges two weight-balanced trees.
+ *
+ * @a: A pointer to the root node of the first tree.
+ * @b: A pointer to the root node of the second tree.
+ *
+ * Return: A pointer to the root node of the tree holding every value of
+ *         @a or @b. Both trees are consumed and duplicates are freed.
+ *
+ * Description: Runs in O(m log(n / m + 1)) for trees of sizes m <= n,
+ * so merging a small batch into a large set only touches the paths it
+ * lands on.
+ */
+bst_t *wbt_union(bst_t *a, bst_t *b)
+{
+	return (wbt_set_op(a, b, WBT_UNION, WBT_SPLITS));
+}
+
+/**
+ * wbt_intersection - Intersects two weight-balanced trees.
+ *
+ * @a: A pointer to the root node of the first tree.
+ * @b: A pointer to the root node of the second tree.
+ *
+ * Return: A pointer to the root node of the tree holding the values
+ *         found in both @a and @b. Both trees are consumed.
+ */
+bst_t *wbt_intersection(bst_t *a, bst_t *b)
+{
+	return (wbt_set_op(a, b, WBT_INTERSECTION, WBT_SPLITS));
+}
+
+/**
+ * wbt_difference - Subtracts a weight-balanced tree from another.
+ *
+ * @a: A pointer to the root node of the tree to subtract from.
+ * @b: A pointer to the root node of the tree of values to drop.
+ *
+ * Return: A pointer to the root node of the tree holding the values of
+ *         @a not found in @b. Both trees are consumed.
+ */
+bst_t *wbt_difference(bst_t *a, bst_t *b)
+{
+	return (wbt_set_op(a, b, WBT_DIFFERENCE, WBT_SPLITS));
+}
@@ -0,0 +1,96 @@
+#include "binary_trees.h"
+
+/**
+ * wbt_size - Reads the size of a weight-balanced subtree.
+ *
+ * @tree: A pointer to the root node of the subtree.
+ *
+ * Return: The number of nodes in @tree, kept in its meta field,
+ *         or 0 if @tree is NULL.
+ */
+size_t wbt_size(const bst_t *tree)
+{
+	return (tree ? (size_t)tree->meta : 0);
+}
+
+/**
+ * wbt_node - Attaches two subtrees below a node.
+ *
+ * @node: A pointer to the node becoming the subtree root.
+ * @left: The new left subtree of @node, may be NULL.
+ * @right: The new right subtree of @node, may be NULL.
+ *
+ * Return: @node, with its size recomputed and no parent.
+ */
+bst_t *wbt_node(bst_t *node, bst_t *left, bst_t *right)
+{
+	node->left = left;
+	node->right = right;
+	node->parent = NULL;
+	if (left != NULL)
+		left->parent = node;
+	if (right != NULL)
+		right->parent = node;
+	node->meta = (int)(1 + wbt_size(left) + wbt_size(right));
+	return (node);
+}
+
+/**
+ * wbt_rotate - Rotates a weight-balanced subtree.
+ *
+ * @tree: A pointer to the root node of the subtree.
+ * @left: 1 to rotate left, 0 to rotate right.
+ *
+ * Return: A pointer to the new subtree root, with sizes updated.
+ */
+bst_t *wbt_rotate(bst_t *tree, int left)
+{
+	bst_t *pivot;
+
+	if (left)
+	{
+		pivot = tree->right;
+		wbt_node(tree, tree->left, pivot->left);
+		return (wbt_node(pivot, tree, pivot->right));
+	}
+	pivot = tree->left;
+	wbt_node(tree, pivot->right, tree->right);
+	return (wbt_node(pivot, pivot->left, tree));
+}
+
+/**
+ * wbt_balance - Restores the weight balance at the root of a subtree.
+ *
+ * @tree: A pointer to the root node of the subtree. Both of its
+ * subtrees must be balanced, its own size may be stale.
+ *
+ * Return: A pointer to the new subtree root.
+ *
+ * Description: A side heavier than WBT_DELTA times the other is
+ * rotated up, with a double rotation when its inner grandchild is at
+ * least WBT_RATIO times its outer one. These are the parameters of
+ * Adams' trees, for which one such step is enough after an insertion,
+ * a deletion or a join step.
+ */
+bst_t *wbt_balance(bst_t *tree)
+{
+	size_t left = wbt_size(tree->left), right = wbt_size(tree->right);
+
+	if (left + right <= 1)
+		return (wbt_node(tree, tree->left, tree->right));
+	if (right > WBT_DELTA * left)
+	{
+		if (wbt_size(tree->right->left) >=
+				WBT_RATIO * wbt_size(tree->right->right))
+			tree->right = wbt_rotate(tree->right, 0);
+		return (wbt_rotate(tree, 1));
+	}
+	if (left > WBT_DELTA * right)
+	{
+		if (wbt_size(tree->left->right) >=
+				WBT_RATIO * wbt_size(tree->left->left))
+			tree->left = wbt_rotate(tree->left, 1);
+		return (wbt_rotate(tree, 0));
+	}
+	return (wbt_node(tree, tree->left, tree->right));
+}
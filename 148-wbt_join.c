@@ -0,0 +1,122 @@
+#include "binary_trees.h"
+
+/**
+ * wbt_join - Joins two weight-balanced trees around a middle node.
+ *
+ * @left: A pointer to the root node of the lower tree, may be NULL.
+ * @mid: A pointer to a detached node greater than every value of @left
+ * and lower than every value of @right.
+ * @right: A pointer to the root node of the upper tree, may be NULL.
+ *
+ * Return: A pointer to the root node of the joined tree.
+ *
+ * Description: When one side is more than WBT_DELTA times heavier, the
+ * join descends its inner spine until the sizes are comparable, hangs
+ * @mid there and rebalances on the way back up. This costs
+ * O(log(n / m + 1)) for trees of sizes n and m. All inputs are consumed.
+ */
+bst_t *wbt_join(bst_t *left, bst_t *mid, bst_t *right)
+{
+	size_t lsize = wbt_size(left), rsize = wbt_size(right);
+
+	if (WBT_DELTA * lsize < rsize)
+	{
+		right->left = wbt_join(left, mid, right->left);
+		return (wbt_balance(right));
+	}
+	if (WBT_DELTA * rsize < lsize)
+	{
+		left->right = wbt_join(left->right, mid, right);
+		return (wbt_balance(left));
+	}
+	return (wbt_node(mid, left, right));
+}
+
+/**
+ * wbt_split_last - Detaches the greatest node of a weight-balanced tree.
+ *
+ * @tree: A pointer to the root node of a non-empty tree.
+ * @last: Address where the detached node is stored.
+ *
+ * Return: A pointer to the root node of the remaining tree.
+ */
+bst_t *wbt_split_last(bst_t *tree, bst_t **last)
+{
+	bst_t *rest;
+
+	if (tree->right == NULL)
+	{
+		rest = tree->left;
+		if (rest != NULL)
+			rest->parent = NULL;
+		*last = wbt_node(tree, NULL, NULL);
+		return (rest);
+	}
+	tree->right = wbt_split_last(tree->right, last);
+	return (wbt_balance(tree));
+}
+
+/**
+ * wbt_join2 - Concatenates two weight-balanced trees.
+ *
+ * @left: A pointer to the root node of the lower tree, may be NULL.
+ * @right: A pointer to the root node of the upper tree, may be NULL.
+ *
+ * Return: A pointer to the root node of the concatenated tree.
+ *
+ * Description: Every value of @left must be lower than every value of
+ * @right. The greatest node of @left becomes the middle of a wbt_join.
+ */
+bst_t *wbt_join2(bst_t *left, bst_t *right)
+{
+	bst_t *mid;
+
+	if (left == NULL)
+		return (right);
+	left = wbt_split_last(left, &mid);
+	return (wbt_join(left, mid, right));
+}
+
+/**
+ * wbt_split - Splits a weight-balanced tree around a key.
+ *
+ * @tree: A pointer to the root node of the tree to split.
+ * @key: The splitting key.
+ * @lo: Address where the tree of the values lower than @key is stored.
+ * @hi: Address where the tree of the values greater than @key is stored.
+ *
+ * Return: The detached node holding @key, or NULL if there is none.
+ *
+ * Description: Each node on the search path of @key is joined back
+ * onto the side it belongs to, in O(log n) overall. @tree is consumed.
+ */
+bst_t *wbt_split(bst_t *tree, int key, bst_t **lo, bst_t **hi)
+{
+	bst_t *left, *right, *found, *sub;
+
+	*lo = NULL;
+	*hi = NULL;
+	if (tree == NULL)
+		return (NULL);
+	left = tree->left;
+	right = tree->right;
+	if (left != NULL)
+		left->parent = NULL;
+	if (right != NULL)
+		right->parent = NULL;
+	if (key < tree->n)
+	{
+		found = wbt_split(left, key, lo, &sub);
+		*hi = wbt_join(sub, tree, right);
+		return (found);
+	}
+	if (key > tree->n)
+	{
+		found = wbt_split(right, key, &sub, hi);
+		*lo = wbt_join(left, tree, sub);
+		return (found);
+	}
+	*lo = left;
+	*hi = right;
+	return (wbt_node(tree, NULL, NULL));
+}
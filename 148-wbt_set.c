@@ -0,0 +1,98 @@
+#include <pthread.h>
+#include "binary_trees.h"
+
+/**
+ * wbt_set_task - Runs one set operation of a pair, as a thread body.
+ *
+ * @arg: A pointer to the wbt_task_t to run.
+ *
+ * Return: Always NULL, the resulting tree is stored in the task.
+ */
+void *wbt_set_task(void *arg)
+{
+	wbt_task_t *task = arg;
+
+	task->result = wbt_set_op(task->a, task->b, task->op, task->splits);
+	return (NULL);
+}
+
+/**
+ * wbt_set_pair - Runs the two independent halves of a set operation.
+ *
+ * @task: An array of two tasks, for the lower and the upper halves.
+ *
+ * @splits: How many more levels may still fork a thread.
+ *
+ * Description: When @splits allows it and the halves hold at least
+ * WBT_GRAIN nodes together, the lower one runs on a new thread while the
+ * calling thread handles the upper one. Otherwise, or if no thread can be
+ * created, both run in turn on the calling thread.
+ */
+void wbt_set_pair(wbt_task_t *task, int splits)
+{
+	pthread_t thread;
+	size_t size = wbt_size(task[0].a) + wbt_size(task[0].b) +
+		wbt_size(task[1].a) + wbt_size(task[1].b);
+
+	if (splits > 0 && size >= WBT_GRAIN &&
+		pthread_create(&thread, NULL, wbt_set_task, &task[0]) == 0)
+	{
+		wbt_set_task(&task[1]);
+		pthread_join(thread, NULL);
+		return;
+	}
+	wbt_set_task(&task[0]);
+	wbt_set_task(&task[1]);
+}
+
+/**
+ * wbt_set_op - Combines two weight-balanced trees.
+ *
+ * @a: A pointer to the root node of the first tree.
+ * @b: A pointer to the root node of the second tree.
+ * @op: WBT_UNION, WBT_INTERSECTION or WBT_DIFFERENCE (@a minus @b).
+ * @splits: How many recursion levels may still fork a thread.
+ *
+ * Return: A pointer to the root node of the resulting tree.
+ *
+ * Description: The root of @b splits @a, both halves are combined
+ * recursively, then joined back around that root when its value
+ * belongs to the result. Both trees are consumed; the nodes that do not
+ * make it into the result are freed.
+ */
+bst_t *wbt_set_op(bst_t *a, bst_t *b, int op, int splits)
+{
+	wbt_task_t task[2];
+	bst_t *found;
+
+	if (a == NULL || b == NULL)
+	{
+		if (op == WBT_UNION)
+			return (a ? a : b);
+		binary_tree_delete(b);
+		if (op == WBT_DIFFERENCE)
+			return (a);
+		binary_tree_delete(a);
+		return (NULL);
+	}
+	task[0].b = b->left;
+	task[1].b = b->right;
+	if (b->left != NULL)
+		b->left->parent = NULL;
+	if (b->right != NULL)
+		b->right->parent = NULL;
+	found = wbt_split(a, b->n, &task[0].a, &task[1].a);
+	task[0].op = op;
+	task[1].op = op;
+	task[0].splits = splits > 0 ? splits - 1 : 0;
+	task[1].splits = task[0].splits;
+	wbt_set_pair(task, splits);
+	if (op == WBT_UNION || (op == WBT_INTERSECTION && found != NULL))
+	{
+		free(found);
+		return (wbt_join(task[0].result, b, task[1].result));
+	}
+	free(found);
+	free(b);
+	return (wbt_join2(task[0].result, task[1].result));
+}
@@ -0,0 +1,189 @@
+#include "binary_trees.h"
+
+/**
+ * bulk_radix_pass - Runs one counting pass of an LSD radix sort.
+ *
+ * @src: The keys to distribute.
+ * @dst: The array receiving the keys, stably ordered on the pass byte.
+ * @size: The number of keys.
+ * @shift: The position of the pass byte in the keys.
+ *
+ * Return: 1 if the keys were moved to @dst, 0 if they all share the
+ *         pass byte and the pass was skipped.
+ */
+int bulk_radix_pass(const unsigned int *src, unsigned int *dst, size_t size,
+		int shift)
+{
+	size_t count[256], i, sum, tmp;
+
+	memset(count, 0, sizeof(count));
+	for (i = 0; i < size; i++)
+		count[(src[i] >> shift) & 0xff]++;
+	if (count[(src[0] >> shift) & 0xff] == size)
+		return (0);
+	for (i = 0, sum = 0; i < 256; i++)
+	{
+		tmp = count[i];
+		count[i] = sum;
+		sum += tmp;
+	}
+	for (i = 0; i < size; i++)
+		dst[count[(src[i] >> shift) & 0xff]++] = src[i];
+	return (1);
+}
+
+/**
+ * bulk_sort_unique - Sorts a copy of an array and drops its duplicates.
+ *
+ * @array: A pointer to the first element of the array.
+ * @size: The number of elements in @array, at least 1.
+ * @count: Address where the number of distinct values is stored.
+ *
+ * Return: A pointer to a new array of the distinct values of @array in
+ *         increasing order, or NULL on failure.
+ *
+ * Description: The values are mapped to unsigned keys with their sign
+ * bit flipped, so that four byte-wise counting passes sort them in
+ * O(n). A single scan then drops the duplicates.
+ */
+int *bulk_sort_unique(const int *array, size_t size, size_t *count)
+{
+	unsigned int *keys, *tmp, *swap;
+	size_t i, j;
+	int shift;
+
+	keys = malloc(sizeof(*keys) * size);
+	tmp = malloc(sizeof(*tmp) * size);
+	if (keys == NULL || tmp == NULL)
+	{
+		free(keys);
+		free(tmp);
+		return (NULL);
+	}
+	for (i = 0; i < size; i++)
+		keys[i] = (unsigned int)array[i] ^ 0x80000000u;
+	for (shift = 0; shift < 32; shift += 8)
+	{
+		if (bulk_radix_pass(keys, tmp, size, shift))
+		{
+			swap = keys;
+			keys = tmp;
+			tmp = swap;
+		}
+	}
+	free(tmp);
+	for (i = 0, j = 0; i < size; i++)
+		if (j == 0 || keys[i] != keys[j - 1])
+			keys[j++] = keys[i];
+	for (i = 0; i < j; i++)
+		((int *)keys)[i] = (int)(keys[i] ^ 0x80000000u);
+	*count = j;
+	return ((int *)keys);
+}
+
+/**
+ * bulk_build - Builds a height-balanced BST from sorted distinct values.
+ *
+ * @array: The sorted distinct values.
+ * @size: The number of values.
+ * @parent: The parent of the subtree being built.
+ * @link: Address where the subtree root is stored.
+ * @pool: Address of the next free node of a contiguous block, or NULL
+ * to allocate each node on its own.
+ *
+ * Return: 1 on success, 0 if a node could not be allocated.
+ *
+ * Description: Picks the same middle element as sorted_array_to_avl
+ * and stores each node height in its meta field, as AVL trees do.
+ * Nodes are taken from @pool in preorder, so the root is the first
+ * node of the block.
+ */
+int bulk_build(const int *array, size_t size, bst_t *parent, bst_t **link,
+		bst_t **pool)
+{
+	size_t mid;
+	bst_t *node;
+	int left, right;
+
+	*link = NULL;
+	if (size == 0)
+		return (1);
+	mid = (size - 1) / 2;
+	if (pool == NULL)
+		node = binary_tree_node(parent, array[mid]);
+	else
+	{
+		node = (*pool)++;
+		node->n = array[mid];
+		node->parent = parent;
+	}
+	if (node == NULL)
+		return (0);
+	*link = node;
+	node->left = NULL;
+	node->right = NULL;
+	if (!bulk_build(array, mid, node, &node->left, pool) ||
+			!bulk_build(array + mid + 1, size - mid - 1, node,
+				&node->right, pool))
+		return (0);
+	left = node->left ? node->left->meta : -1;
+	right = node->right ? node->right->meta : -1;
+	node->meta = 1 + (left > right ? left : right);
+	return (1);
+}
+
+/**
+ * bst_bulk_load - Builds a height-balanced BST from an unsorted array.
+ *
+ * @array: A pointer to the first element of the array.
+ * @size: The number of elements in @array.
+ * @contiguous: 1 to place every node in a single block, 0 to allocate
+ * each node on its own.
+ *
+ * Return: A pointer to the root node of the created BST, or NULL on
+ *         failure. Duplicate values are ignored.
+ *
+ * Description: Sorts a copy of @array, drops its duplicates and builds
+ * the tree in O(n) overall, whatever the input order. A tree built
+ * from separate nodes works with every BST function. A contiguous tree
+ * is faster to build and walk but must not be modified, and is freed
+ * with bst_bulk_delete instead of binary_tree_delete.
+ */
+bst_t *bst_bulk_load(const int *array, size_t size, int contiguous)
+{
+	bst_t *root, *pool = NULL;
+	int *sorted;
+	size_t count;
+
+	if (array == NULL || size == 0)
+		return (NULL);
+	sorted = bulk_sort_unique(array, size, &count);
+	if (sorted == NULL)
+		return (NULL);
+	if (contiguous)
+	{
+		pool = malloc(sizeof(*pool) * count);
+		if (pool == NULL)
+		{
+			free(sorted);
+			return (NULL);
+		}
+	}
+	if (!bulk_build(sorted, count, NULL, &root, pool ? &pool : NULL))
+	{
+		binary_tree_delete(root);
+		root = NULL;
+	}
+	free(sorted);
+	return (root);
+}
+
+/**
+ * bst_bulk_delete - Frees a tree built by bst_bulk_load in one block.
+ *
+ * @root: A pointer to the root node of the contiguous tree.
+ */
+void bst_bulk_delete(bst_t *root)
+{
+	free(root);
+}
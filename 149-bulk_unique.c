@@ -0,0 +1,71 @@
+#include "binary_trees.h"
+
+/**
+ * sorted_index_of - Finds a value in a sorted array of distinct values.
+ *
+ * @sorted: The sorted array.
+ * @count: The number of elements in @sorted.
+ * @value: The value to find, which must be present.
+ *
+ * Return: The index of @value in @sorted.
+ */
+size_t sorted_index_of(const int *sorted, size_t count, int value)
+{
+	size_t lo = 0, hi = count - 1, mid;
+
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (sorted[mid] < value)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return (lo);
+}
+
+/**
+ * bulk_unique_order - Drops the duplicates of an array, keeping the
+ * first occurrence of each value in place.
+ *
+ * @array: A pointer to the first element of the array.
+ * @size: The number of elements in @array, at least 1.
+ * @count: Address where the number of distinct values is stored.
+ *
+ * Return: A malloc'd array of the distinct values of @array in order of
+ *         first occurrence, or NULL on failure.
+ *
+ * Description: Duplicates are spotted with one sort of a copy
+ * (bulk_sort_unique) and a scan marking each distinct value once seen,
+ * in O(n log n) instead of comparing every pair.
+ */
+int *bulk_unique_order(const int *array, size_t size, size_t *count)
+{
+	int *sorted, *order = NULL;
+	unsigned char *seen = NULL;
+	size_t i, pos, kept = 0;
+
+	sorted = bulk_sort_unique(array, size, count);
+	if (sorted != NULL)
+	{
+		seen = calloc(*count, sizeof(*seen));
+		order = malloc(sizeof(*order) * *count);
+	}
+	for (i = 0; seen != NULL && order != NULL && i < size; i++)
+	{
+		pos = sorted_index_of(sorted, *count, array[i]);
+		if (!seen[pos])
+		{
+			seen[pos] = 1;
+			order[kept++] = array[i];
+		}
+	}
+	if (seen == NULL)
+	{
+		free(order);
+		order = NULL;
+	}
+	free(sorted);
+	free(seen);
+	return (order);
+}
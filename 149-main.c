@@ -0,0 +1,38 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *tree;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95, 47, 21, -5
+    };
+    int sorted[100000];
+    size_t n = sizeof(array) / sizeof(array[0]), i;
+
+    tree = bst_bulk_load(array, n, 0);
+    if (!tree)
+        return (1);
+    binary_tree_print(tree);
+    printf("Is BST: %d, is AVL: %d\n", binary_tree_is_bst(tree),
+           binary_tree_is_avl(tree));
+    binary_tree_delete(tree);
+
+    for (i = 0; i < 100000; i++)
+        sorted[i] = (int)i;
+    tree = bst_bulk_load(sorted, 100000, 1);
+    if (!tree)
+        return (1);
+    printf("Sorted input, contiguous: %lu nodes, height %lu, is BST: %d\n",
+           (unsigned long)binary_tree_size(tree),
+           (unsigned long)binary_tree_height(tree), binary_tree_is_bst(tree));
+    bst_bulk_delete(tree);
+    return (0);
+}
@@ -0,0 +1,110 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/*
+ * gcc -O2 150-bench.c 150-bst_freeze.c 150-bst_frozen_search.c
+ *     154-bst_neighbors.c
+ *     124-sorted_array_to_avl.c 153-avl_retrace.c 103-binary_tree_rotate_left.c
+ *     104-binary_tree_rotate_right.c 113-bst_search.c 3-binary_tree_delete.c
+ *     0-binary_tree_node.c -o 150-bench
+ *
+ * ./150-bench [max_exponent], sizes 10^4 up to 10^max_exponent (default 8,
+ * which needs about 5 GB of memory)
+ */
+
+#define LOOKUPS 2000000
+
+/**
+ * seconds - Reads a monotonic clock
+ *
+ * Return: The current time in seconds
+ */
+double seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec + now.tv_nsec / 1e9);
+}
+
+/**
+ * bench_size - Times both searches over an AVL tree of n even keys
+ *
+ * @n: Number of keys
+ * @lookups: Array of LOOKUPS random values, half of them present
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int bench_size(size_t n, int *lookups)
+{
+    int *keys;
+    avl_t *tree;
+    bst_frozen_t *index;
+    size_t i, hits[2] = {0, 0}, bad = 0;
+    double start, avl_time, frozen_time;
+
+    keys = malloc(sizeof(*keys) * n);
+    if (!keys)
+        return (1);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)(2 * i);
+    tree = sorted_array_to_avl(keys, n);
+    free(keys);
+    index = bst_freeze(tree);
+    if (!tree || !index)
+        return (1);
+    for (i = 0; i < LOOKUPS; i++)
+        lookups[i] = (int)(((size_t)rand() * (RAND_MAX + 1UL) + rand()) %
+                           (2 * n));
+    start = seconds();
+    for (i = 0; i < LOOKUPS; i++)
+        hits[0] += bst_search(tree, lookups[i]) != NULL;
+    avl_time = seconds() - start;
+    start = seconds();
+    for (i = 0; i < LOOKUPS; i++)
+        hits[1] += bst_frozen_search(index, lookups[i]) != NULL;
+    frozen_time = seconds() - start;
+    for (i = 0; i < LOOKUPS; i += 97)
+        bad += bst_search(tree, lookups[i]) !=
+            bst_frozen_search(index, lookups[i]);
+    printf("%10lu keys: bst_search %6.1f ns, bst_frozen_search %6.1f ns"
+           " (x%.2f), hits %lu/%lu, mismatches %lu\n", (unsigned long)n,
+           avl_time * 1e9 / LOOKUPS, frozen_time * 1e9 / LOOKUPS,
+           avl_time / frozen_time, (unsigned long)hits[0],
+           (unsigned long)hits[1], (unsigned long)bad);
+    bst_frozen_delete(index);
+    binary_tree_delete(tree);
+    return (0);
+}
+
+/**
+ * main - Benchmarks bst_frozen_search against bst_search on AVL trees
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments, the optional largest power of ten to measure
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int argc, char **argv)
+{
+    int *lookups, max = argc > 1 ? atoi(argv[1]) : 8, e;
+    size_t n = 1000;
+
+    lookups = malloc(sizeof(*lookups) * LOOKUPS);
+    if (!lookups)
+        return (1);
+    srand(12);
+    for (e = 4; e <= max; e++)
+    {
+        n *= 10;
+        if (bench_size(n, lookups))
+        {
+            printf("%lu keys: out of memory\n", (unsigned long)n);
+            break;
+        }
+    }
+    free(lookups);
+    return (0);
+}
@@ -0,0 +1,76 @@
+#include "binary_trees.h"
+
+/**
+ * freeze_fill - Lays the nodes of a BST out in Eytzinger order.
+ *
+ * @index: A pointer to the index being filled.
+ * @k: The Eytzinger position to fill, its children are at 2k and 2k + 1.
+ * @node: Address of the next node in order, advanced as it is placed.
+ *
+ * Description: An in-order walk of the implicit tree of positions meets
+ * them in key order, so handing it the BST nodes in order fills every
+ * position with the right key. The recursion is O(log n) deep.
+ */
+void freeze_fill(bst_frozen_t *index, size_t k, const bst_t **node)
+{
+	if (k > index->size)
+		return;
+	freeze_fill(index, 2 * k, node);
+	index->keys[k] = (*node)->n;
+	index->nodes[k] = *node;
+	*node = bst_successor(*node);
+	freeze_fill(index, 2 * k + 1, node);
+}
+
+/**
+ * bst_freeze - Builds a read-only Eytzinger search index over a BST.
+ *
+ * @root: A pointer to the root node of the BST to index.
+ *
+ * Return: A pointer to the new index, or NULL on failure.
+ *
+ * Description: The keys are stored breadth first in one cache-aligned
+ * array, position k having its children at 2k and 2k + 1, so the top
+ * levels of every search share the same few cache lines. The tree must
+ * not change while the index is in use.
+ */
+bst_frozen_t *bst_freeze(const bst_t *root)
+{
+	bst_frozen_t *index;
+	const bst_t *node;
+	size_t n = 0;
+
+	if (root == NULL)
+		return (NULL);
+	for (node = bst_min(root); node != NULL; node = bst_successor(node))
+		n++;
+	index = calloc(1, sizeof(*index));
+	if (index == NULL)
+		return (NULL);
+	index->size = n;
+	index->block = malloc(sizeof(*index->keys) * (n + 1) + 63);
+	index->nodes = malloc(sizeof(*index->nodes) * (n + 1));
+	if (index->block == NULL || index->nodes == NULL)
+	{
+		bst_frozen_delete(index);
+		return (NULL);
+	}
+	index->keys = (int *)(((size_t)index->block + 63) & ~(size_t)63);
+	node = bst_min(root);
+	freeze_fill(index, 1, &node);
+	return (index);
+}
+
+/**
+ * bst_frozen_delete - Frees an Eytzinger search index.
+ *
+ * @index: A pointer to the index to free. The indexed tree is untouched.
+ */
+void bst_frozen_delete(bst_frozen_t *index)
+{
+	if (index == NULL)
+		return;
+	free(index->block);
+	free(index->nodes);
+	free(index);
+}
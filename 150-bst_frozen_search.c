@@ -0,0 +1,41 @@
+#include "binary_trees.h"
+
+/**
+ * bst_frozen_search - Searches for a value in an Eytzinger index.
+ *
+ * @index: A pointer to an index built by bst_freeze.
+ * @value: The value to search for.
+ *
+ * Return: A pointer to the node of the frozen BST holding @value, or
+ *         NULL if @index is NULL or @value is not found, like bst_search.
+ *
+ * Description: Each step moves to child 2k + (key < value) without a
+ * data-dependent branch, while the 16 descendants four levels down,
+ * which share one cache line, are prefetched. Once past the leaves, the
+ * trailing right turns are dropped from k to land on the lower bound.
+ */
+bst_t *bst_frozen_search(const bst_frozen_t *index, int value)
+{
+	const int *keys;
+	size_t k = 1, n;
+
+	if (index == NULL)
+		return (NULL);
+	keys = index->keys;
+	n = index->size;
+	while (k <= n)
+	{
+		TREE_PREFETCH(keys + 16 * k);
+		k = 2 * k + (keys[k] < value);
+	}
+#ifdef __GNUC__
+	k >>= __builtin_ctzl((unsigned long)~k) + 1;
+#else
+	while (k & 1)
+		k >>= 1;
+	k >>= 1;
+#endif
+	if (k == 0 || keys[k] != value)
+		return (NULL);
+	return ((bst_t *)index->nodes[k]);
+}
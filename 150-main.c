@@ -0,0 +1,43 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    avl_t *tree;
+    bst_frozen_t *index;
+    bst_t *node;
+    int array[] = {
+        1, 2, 20, 21, 22, 32, 34, 47, 62, 68,
+        79, 84, 87, 91, 95, 98
+    };
+    int lookups[] = {47, 98, 1, 50, 0, 100};
+    size_t n = sizeof(array) / sizeof(array[0]), i;
+
+    tree = sorted_array_to_avl(array, n);
+    if (!tree)
+        return (1);
+    index = bst_freeze(tree);
+    if (!index)
+        return (1);
+    binary_tree_print(tree);
+    printf("Eytzinger order:");
+    for (i = 1; i <= index->size; i++)
+        printf(" %d", index->keys[i]);
+    printf("\n");
+    for (i = 0; i < sizeof(lookups) / sizeof(lookups[0]); i++)
+    {
+        node = bst_frozen_search(index, lookups[i]);
+        printf("Search %d: %s (same node as bst_search: %d)\n", lookups[i],
+               node ? "found" : "not found",
+               node == bst_search(tree, lookups[i]));
+    }
+    bst_frozen_delete(index);
+    binary_tree_delete(tree);
+    return (0);
+}
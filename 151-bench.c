@@ -0,0 +1,119 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/*
+ * gcc -O2 -mavx2 151-bench.c 151-stree.c 151-stree_search.c
+ *     151-stree_batch.c 150-bst_freeze.c 150-bst_frozen_search.c
+ *     154-bst_neighbors.c
+ *     124-sorted_array_to_avl.c 153-avl_retrace.c 103-binary_tree_rotate_left.c
+ *     104-binary_tree_rotate_right.c 113-bst_search.c 3-binary_tree_delete.c
+ *     0-binary_tree_node.c -o 151-bench
+ *
+ * ./151-bench [max_exponent], sizes 10^4 up to 10^max_exponent (default 7)
+ */
+
+#define LOOKUPS 2000000
+
+/**
+ * seconds - Reads a monotonic clock
+ *
+ * Return: The current time in seconds
+ */
+double seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec + now.tv_nsec / 1e9);
+}
+
+/**
+ * bench_size - Times the searches over an AVL tree of n even keys
+ *
+ * @n: Number of keys
+ * @lookups: Array of LOOKUPS random values, half of them present
+ * @out: Array of LOOKUPS nodes for the batch search
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int bench_size(size_t n, int *lookups, bst_t **out)
+{
+    int *keys;
+    avl_t *tree;
+    bst_frozen_t *frozen;
+    stree_t *stree;
+    size_t i, hits[4] = {0, 0, 0, 0};
+    double t[5];
+
+    keys = malloc(sizeof(*keys) * n);
+    if (!keys)
+        return (1);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)(2 * i);
+    tree = sorted_array_to_avl(keys, n);
+    free(keys);
+    frozen = bst_freeze(tree);
+    stree = stree_create(tree);
+    if (!tree || !frozen || !stree)
+        return (1);
+    for (i = 0; i < LOOKUPS; i++)
+        lookups[i] = (int)(((size_t)rand() * (RAND_MAX + 1UL) + rand()) %
+                           (2 * n));
+    t[0] = seconds();
+    for (i = 0; i < LOOKUPS; i++)
+        hits[0] += bst_search(tree, lookups[i]) != NULL;
+    t[1] = seconds();
+    for (i = 0; i < LOOKUPS; i++)
+        hits[1] += bst_frozen_search(frozen, lookups[i]) != NULL;
+    t[2] = seconds();
+    for (i = 0; i < LOOKUPS; i++)
+        hits[2] += stree_search(stree, lookups[i]) != NULL;
+    t[3] = seconds();
+    hits[3] = stree_search_batch(stree, lookups, LOOKUPS, out);
+    t[4] = seconds();
+    printf("%9lu keys: bst_search %6.1f ns, frozen %6.1f ns, stree %6.1f ns,"
+           " stree batch %6.1f ns, hits %s\n", (unsigned long)n,
+           (t[1] - t[0]) * 1e9 / LOOKUPS, (t[2] - t[1]) * 1e9 / LOOKUPS,
+           (t[3] - t[2]) * 1e9 / LOOKUPS, (t[4] - t[3]) * 1e9 / LOOKUPS,
+           hits[0] == hits[1] && hits[0] == hits[2] && hits[0] == hits[3] ?
+           "match" : "MISMATCH");
+    stree_delete(stree);
+    bst_frozen_delete(frozen);
+    binary_tree_delete(tree);
+    return (0);
+}
+
+/**
+ * main - Benchmarks the S-tree searches against bst_search on AVL trees
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments, the optional largest power of ten to measure
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int argc, char **argv)
+{
+    int *lookups, max = argc > 1 ? atoi(argv[1]) : 7, e;
+    bst_t **out;
+    size_t n = 1000;
+
+    lookups = malloc(sizeof(*lookups) * LOOKUPS);
+    out = malloc(sizeof(*out) * LOOKUPS);
+    if (!lookups || !out)
+        return (1);
+    srand(12);
+    for (e = 4; e <= max; e++)
+    {
+        n *= 10;
+        if (bench_size(n, lookups, out))
+        {
+            printf("%lu keys: out of memory\n", (unsigned long)n);
+            break;
+        }
+    }
+    free(lookups);
+    free(out);
+    return (0);
+}
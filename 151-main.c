@@ -0,0 +1,42 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    avl_t *tree;
+    stree_t *index;
+    bst_t *lo, *hi, *found[5];
+    int array[40], lookups[] = {0, 33, 34, 79, 100};
+    size_t i, n = 40;
+
+    for (i = 0; i < n; i++)
+        array[i] = (int)(2 * i);
+    tree = sorted_array_to_avl(array, n);
+    index = stree_create(tree);
+    if (!tree || !index)
+        return (1);
+    printf("%lu keys in %lu blocks of %d:\n", (unsigned long)index->size,
+           (unsigned long)index->blocks, STREE_B);
+    for (i = 0; i < index->blocks * STREE_B; i++)
+        printf("%d%s", index->keys[i] == 2147483647 ? -1 : index->keys[i],
+               (i + 1) % STREE_B ? " " : "\n");
+    for (i = 0; i < 5; i++)
+    {
+        lo = stree_lower_bound(index, lookups[i]);
+        hi = stree_upper_bound(index, lookups[i]);
+        printf("%d: lower bound %d, upper bound %d, search %s\n",
+               lookups[i], lo ? lo->n : -1, hi ? hi->n : -1,
+               stree_search(index, lookups[i]) ? "found" : "not found");
+    }
+    printf("Batch found %lu of 5\n",
+           (unsigned long)stree_search_batch(index, lookups, 5, found));
+    stree_delete(index);
+    binary_tree_delete(tree);
+    return (0);
+}
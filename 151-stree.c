@@ -0,0 +1,88 @@
+#include "binary_trees.h"
+#include "limits.h"
+
+/**
+ * stree_fill - Lays the nodes of a BST out in S-tree order.
+ *
+ * @tree: A pointer to the S-tree being filled.
+ * @k: The block to fill, its children are the blocks
+ * k * (STREE_B + 1) + i + 1 for i from 0 to STREE_B.
+ * @node: Address of the next BST node in order, advanced as it is placed.
+ *
+ * Description: Key i of a block sits between the keys of children i and
+ * i + 1, so an in-order walk of the blocks meets the slots in key order.
+ * Slots past the last node are padded with INT_MAX and no node, which
+ * keeps each block sorted. The recursion is O(log n) deep.
+ */
+void stree_fill(stree_t *tree, size_t k, const bst_t **node)
+{
+	size_t i, slot;
+
+	if (k >= tree->blocks)
+		return;
+	for (i = 0; i < STREE_B; i++)
+	{
+		stree_fill(tree, k * (STREE_B + 1) + i + 1, node);
+		slot = k * STREE_B + i;
+		tree->keys[slot] = *node ? (*node)->n : INT_MAX;
+		tree->nodes[slot] = *node;
+		if (*node != NULL)
+			*node = bst_successor(*node);
+	}
+	stree_fill(tree, k * (STREE_B + 1) + STREE_B + 1, node);
+}
+
+/**
+ * stree_create - Builds a static k-ary search tree over a BST.
+ *
+ * @root: A pointer to the root node of the BST to index.
+ *
+ * Return: A pointer to the new S-tree, or NULL on failure.
+ *
+ * Description: The keys are packed STREE_B to a 64-byte block, each
+ * block having STREE_B + 1 children, so a search touches one cache line
+ * per log2(STREE_B + 1) levels of the BST and ranks each line with a
+ * few vector compares. The BST must not change while the S-tree is in
+ * use.
+ */
+stree_t *stree_create(const bst_t *root)
+{
+	stree_t *tree;
+	const bst_t *node;
+	size_t n = 0;
+
+	if (root == NULL)
+		return (NULL);
+	for (node = bst_min(root); node != NULL; node = bst_successor(node))
+		n++;
+	tree = calloc(1, sizeof(*tree));
+	if (tree == NULL)
+		return (NULL);
+	tree->size = n;
+	tree->blocks = (n + STREE_B - 1) / STREE_B;
+	tree->block = malloc(sizeof(*tree->keys) * tree->blocks * STREE_B + 63);
+	tree->nodes = malloc(sizeof(*tree->nodes) * tree->blocks * STREE_B);
+	if (tree->block == NULL || tree->nodes == NULL)
+	{
+		stree_delete(tree);
+		return (NULL);
+	}
+	tree->keys = (int *)(((size_t)tree->block + 63) & ~(size_t)63);
+	node = bst_min(root);
+	stree_fill(tree, 0, &node);
+	return (tree);
+}
+
+/**
+ * stree_delete - Frees a static k-ary search tree.
+ *
+ * @tree: A pointer to the S-tree to free. The indexed BST is untouched.
+ */
+void stree_delete(stree_t *tree)
+{
+	if (tree == NULL)
+		return;
+	free(tree->block);
+	free(tree->nodes);
+	free(tree);
+}
@@ -0,0 +1,77 @@
+#include "binary_trees.h"
+
+/**
+ * stree_batch_group - Runs a group of S-tree searches side by side.
+ *
+ * @tree: A pointer to the S-tree to search.
+ * @values: The values to search for, at most STREE_GROUP of them.
+ * @count: The number of values.
+ * @out: Array receiving the node found for each value, or NULL.
+ *
+ * Description: The searches advance one level at a time in lockstep.
+ * Each one prefetches the block it moves to, so the cache misses of the
+ * whole group overlap instead of being paid one after the other.
+ */
+void stree_batch_group(const stree_t *tree, const int *values, size_t count,
+		bst_t **out)
+{
+	size_t k[STREE_GROUP], slot[STREE_GROUP], i, j, active = count;
+
+	for (j = 0; j < count; j++)
+	{
+		k[j] = 0;
+		slot[j] = (size_t)-1;
+	}
+	while (active > 0)
+	{
+		active = 0;
+		for (j = 0; j < count; j++)
+		{
+			if (k[j] >= tree->blocks)
+				continue;
+			i = stree_rank(tree->keys + k[j] * STREE_B, values[j]);
+			if (i < STREE_B)
+				slot[j] = k[j] * STREE_B + i;
+			k[j] = k[j] * (STREE_B + 1) + i + 1;
+			if (k[j] < tree->blocks)
+			{
+				TREE_PREFETCH(tree->keys + k[j] * STREE_B);
+				active++;
+			}
+		}
+	}
+	for (j = 0; j < count; j++)
+	{
+		out[j] = NULL;
+		if (slot[j] != (size_t)-1 && tree->keys[slot[j]] == values[j])
+			out[j] = (bst_t *)tree->nodes[slot[j]];
+	}
+}
+
+/**
+ * stree_search_batch - Searches for many values in an S-tree.
+ *
+ * @tree: A pointer to the S-tree to search.
+ * @values: The values to search for.
+ * @count: The number of values.
+ * @out: Array receiving, for each value, the BST node holding it or NULL,
+ * like stree_search.
+ *
+ * Return: The number of values found.
+ */
+size_t stree_search_batch(const stree_t *tree, const int *values,
+		size_t count, bst_t **out)
+{
+	size_t i, group, found = 0;
+
+	if (tree == NULL || values == NULL || out == NULL)
+		return (0);
+	for (i = 0; i < count; i += group)
+	{
+		group = count - i < STREE_GROUP ? count - i : STREE_GROUP;
+		stree_batch_group(tree, values + i, group, out + i);
+	}
+	for (i = 0; i < count; i++)
+		found += out[i] != NULL;
+	return (found);
+}
@@ -0,0 +1,127 @@
+#include "binary_trees.h"
+#include "limits.h"
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * stree_rank - Counts the keys of a block lower than a value.
+ *
+ * @keys: A pointer to the STREE_B sorted keys of a 64-byte aligned block.
+ * @value: The value to rank.
+ *
+ * Return: The number of keys lower than @value, which is the child to
+ *         descend to.
+ *
+ * Description: Compares the whole block at once with AVX2 (two 8-lane
+ * compares) or SSE2 (four 4-lane compares). The block being sorted, the
+ * compare mask is a run of low bits, counted by its trailing ones.
+ * Without either, falls back to a branchless loop.
+ */
+size_t stree_rank(const int *keys, int value)
+{
+	size_t count = 0;
+#ifdef __AVX2__
+	__m256i x = _mm256_set1_epi32(value), a, b;
+	const __m256i *block = (const __m256i *)keys;
+
+	a = _mm256_cmpgt_epi32(x, block[0]);
+	b = _mm256_cmpgt_epi32(x, block[1]);
+	count = __builtin_ctz(~(_mm256_movemask_ps(_mm256_castsi256_ps(a)) |
+			_mm256_movemask_ps(_mm256_castsi256_ps(b)) << 8));
+#elif defined(__SSE2__)
+	__m128i x = _mm_set1_epi32(value), a, b;
+	const __m128i *block = (const __m128i *)keys;
+
+	a = _mm_packs_epi32(_mm_cmpgt_epi32(x, block[0]),
+			_mm_cmpgt_epi32(x, block[1]));
+	b = _mm_packs_epi32(_mm_cmpgt_epi32(x, block[2]),
+			_mm_cmpgt_epi32(x, block[3]));
+	count = __builtin_ctz(~_mm_movemask_epi8(_mm_packs_epi16(a, b)));
+#else
+	size_t i;
+
+	for (i = 0; i < STREE_B; i++)
+		count += keys[i] < value;
+#endif
+	return (count);
+}
+
+/**
+ * stree_bound - Finds the first slot of an S-tree not lower than a value.
+ *
+ * @tree: A pointer to the S-tree to search.
+ * @value: The value to search for.
+ *
+ * Return: The slot of the lowest key >= @value, or (size_t)-1 if there
+ *         is none. A padding slot may be returned, its node is NULL.
+ */
+size_t stree_bound(const stree_t *tree, int value)
+{
+	size_t k = 0, i, slot = (size_t)-1;
+
+	while (k < tree->blocks)
+	{
+		i = stree_rank(tree->keys + k * STREE_B, value);
+		if (i < STREE_B)
+			slot = k * STREE_B + i;
+		k = k * (STREE_B + 1) + i + 1;
+	}
+	return (slot);
+}
+
+/**
+ * stree_lower_bound - Finds the lowest key not lower than a value.
+ *
+ * @tree: A pointer to the S-tree to search.
+ * @value: The value to search for.
+ *
+ * Return: A pointer to the BST node holding the lowest key >= @value,
+ *         or NULL if @tree is NULL or there is no such key.
+ */
+bst_t *stree_lower_bound(const stree_t *tree, int value)
+{
+	size_t slot;
+
+	if (tree == NULL)
+		return (NULL);
+	slot = stree_bound(tree, value);
+	return (slot == (size_t)-1 ? NULL : (bst_t *)tree->nodes[slot]);
+}
+
+/**
+ * stree_upper_bound - Finds the lowest key greater than a value.
+ *
+ * @tree: A pointer to the S-tree to search.
+ * @value: The value to search for.
+ *
+ * Return: A pointer to the BST node holding the lowest key > @value,
+ *         or NULL if @tree is NULL or there is no such key.
+ */
+bst_t *stree_upper_bound(const stree_t *tree, int value)
+{
+	size_t slot;
+
+	if (tree == NULL || value == INT_MAX)
+		return (NULL);
+	slot = stree_bound(tree, value + 1);
+	return (slot == (size_t)-1 ? NULL : (bst_t *)tree->nodes[slot]);
+}
+
+/**
+ * stree_search - Searches for a value in an S-tree.
+ *
+ * @tree: A pointer to the S-tree to search.
+ * @value: The value to search for.
+ *
+ * Return: A pointer to the BST node holding @value, or NULL if @tree is
+ *         NULL or @value is not found, like bst_search.
+ */
+bst_t *stree_search(const stree_t *tree, int value)
+{
+	bst_t *node = stree_lower_bound(tree, value);
+
+	return (node != NULL && node->n == value ? node : NULL);
+}
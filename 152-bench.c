@@ -0,0 +1,132 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/*
+ * gcc -O2 152-bench.c 152-bst_search_many.c 124-sorted_array_to_avl.c
+ *     153-avl_retrace.c 103-binary_tree_rotate_left.c
+ *     104-binary_tree_rotate_right.c 111-bst_insert.c 113-bst_search.c
+ *     3-binary_tree_delete.c 0-binary_tree_node.c -o 152-bench
+ *
+ * ./152-bench [max_exponent], sizes 10^4 up to 10^max_exponent (default 7)
+ */
+
+#define LOOKUPS 2000000
+
+/**
+ * seconds - Reads a monotonic clock
+ *
+ * Return: The current time in seconds
+ */
+double seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec + now.tv_nsec / 1e9);
+}
+
+/**
+ * bench_tree - Times a loop of bst_search against bst_search_many
+ *
+ * @name: Name of the tree shape
+ * @tree: Pointer to the root node of the tree
+ * @n: Number of keys in the tree
+ * @lookups: Array of LOOKUPS values to search for
+ * @out: Array of LOOKUPS nodes for bst_search_many
+ */
+void bench_tree(const char *name, const bst_t *tree, size_t n,
+                const int *lookups, bst_t **out)
+{
+    size_t i, hits = 0, many;
+    double start, loop, batch;
+
+    start = seconds();
+    for (i = 0; i < LOOKUPS; i++)
+        hits += bst_search(tree, lookups[i]) != NULL;
+    loop = seconds() - start;
+    start = seconds();
+    many = bst_search_many(tree, lookups, LOOKUPS, out);
+    batch = seconds() - start;
+    printf("%9lu keys, %-8s bst_search %6.1f M/s, bst_search_many %6.1f M/s"
+           " (x%.2f), hits %s\n", (unsigned long)n, name,
+           LOOKUPS / loop / 1e6, LOOKUPS / batch / 1e6, loop / batch,
+           hits == many ? "match" : "MISMATCH");
+}
+
+/**
+ * bench_size - Benchmarks both searches on two trees of n even keys
+ *
+ * @n: Number of keys
+ * @lookups: Array of LOOKUPS values, filled with random values
+ * @out: Array of LOOKUPS nodes for bst_search_many
+ *
+ * Return: 0 on success, 1 on failure
+ *
+ * Description: The AVL tree comes from sorted_array_to_avl, which
+ * allocates its nodes in preorder; the BST is grown by bst_insert in
+ * random order, which scatters its nodes across the heap.
+ */
+int bench_size(size_t n, int *lookups, bst_t **out)
+{
+    int *keys, tmp;
+    bst_t *tree;
+    size_t i, j;
+
+    keys = malloc(sizeof(*keys) * n);
+    if (!keys)
+        return (1);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)(2 * i);
+    for (i = 0; i < LOOKUPS; i++)
+        lookups[i] = (int)(((size_t)rand() * (RAND_MAX + 1UL) + rand()) %
+                           (2 * n));
+    tree = sorted_array_to_avl(keys, n);
+    bench_tree("AVL,", tree, n, lookups, out);
+    binary_tree_delete(tree);
+    for (i = n; i > 1; i--)
+    {
+        j = ((size_t)rand() * (RAND_MAX + 1UL) + rand()) % i;
+        tmp = keys[i - 1];
+        keys[i - 1] = keys[j];
+        keys[j] = tmp;
+    }
+    tree = NULL;
+    for (i = 0; i < n; i++)
+        bst_insert(&tree, keys[i]);
+    free(keys);
+    bench_tree("random,", tree, n, lookups, out);
+    binary_tree_delete(tree);
+    return (0);
+}
+
+/**
+ * main - Benchmarks bst_search_many against a loop of bst_search
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments, the optional largest power of ten to measure
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int argc, char **argv)
+{
+    int *lookups, max = argc > 1 ? atoi(argv[1]) : 7, e;
+    bst_t **out;
+    size_t n = 1000;
+
+    lookups = malloc(sizeof(*lookups) * LOOKUPS);
+    out = malloc(sizeof(*out) * LOOKUPS);
+    if (!lookups || !out)
+        return (1);
+    srand(12);
+    for (e = 4; e <= max; e++)
+    {
+        n *= 10;
+        if (bench_size(n, lookups, out))
+            break;
+    }
+    free(lookups);
+    free(out);
+    return (0);
+}
@@ -0,0 +1,82 @@
+#include "binary_trees.h"
+
+/**
+ * bst_walk_many - Runs many BST descents side by side.
+ *
+ * @tree: A pointer to the root node of the BST.
+ * @keys: The values to look for.
+ * @count: The number of values.
+ * @out: Array receiving the answer for each value.
+ * @mode: SEARCH_EXACT, SEARCH_FLOOR or SEARCH_CEILING.
+ *
+ * Return: The number of values found exactly.
+ *
+ * Description: Keeps SEARCH_MANY_GROUP descents in flight and moves each
+ * of them one node down in turn, prefetching the child it lands on. By
+ * the time a descent comes round again its node has usually arrived, so
+ * up to a group of cache misses overlap instead of being paid one after
+ * the other. A finished descent hands its slot to the next value at once.
+ * A descent that falls off the tree answers with the last node passed on
+ * the side @mode asks for, or NULL for SEARCH_EXACT.
+ */
+size_t bst_walk_many(const bst_t *tree, const int *keys, size_t count,
+		bst_t **out, int mode)
+{
+	const bst_t *node[SEARCH_MANY_GROUP], *best[SEARCH_MANY_GROUP], *cur;
+	size_t slot[SEARCH_MANY_GROUP], next = 0, active = 0, j, found = 0;
+	int below, side;
+
+	for (j = 0; j < SEARCH_MANY_GROUP; j++)
+	{
+		node[j] = tree;
+		best[j] = NULL;
+		slot[j] = next < count ? next++ : (size_t)-1;
+		active += slot[j] != (size_t)-1;
+	}
+	while (active > 0)
+		for (j = 0; j < SEARCH_MANY_GROUP; j++)
+		{
+			cur = node[j];
+			if (slot[j] == (size_t)-1)
+				continue;
+			if (cur != NULL && cur->n != keys[slot[j]])
+			{
+				below = cur->n < keys[slot[j]];
+				side = below ? SEARCH_FLOOR : SEARCH_CEILING;
+				if (side == mode)
+					best[j] = cur;
+				node[j] = below ? cur->right : cur->left;
+				TREE_PREFETCH(node[j]);
+				continue;
+			}
+			out[slot[j]] = (bst_t *)(cur ? cur : best[j]);
+			found += cur != NULL;
+			node[j] = tree;
+			best[j] = NULL;
+			slot[j] = next < count ? next++ : (size_t)-1;
+			active -= slot[j] == (size_t)-1;
+		}
+	return (found);
+}
+
+/**
+ * bst_search_many - Searches for many values in a BST at once.
+ *
+ * @tree: A pointer to the root node of the BST to search.
+ * @keys: The values to search for.
+ * @count: The number of values.
+ * @out: Array receiving, for each value, the node holding it or NULL,
+ * like bst_search.
+ *
+ * Return: The number of values found.
+ *
+ * Description: Overlaps the cache misses of the searches through
+ * bst_walk_many.
+ */
+size_t bst_search_many(const bst_t *tree, const int *keys, size_t count,
+		bst_t **out)
+{
+	if (keys == NULL || out == NULL)
+		return (0);
+	return (bst_walk_many(tree, keys, count, out, SEARCH_EXACT));
+}
@@ -0,0 +1,30 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *tree, *out[8];
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    int keys[] = {32, 33, 1, 98, 0, 62, 100, 47};
+    size_t n = sizeof(array) / sizeof(array[0]), i, found;
+
+    tree = array_to_bst(array, n);
+    if (!tree)
+        return (1);
+    binary_tree_print(tree);
+    found = bst_search_many(tree, keys, 8, out);
+    for (i = 0; i < 8; i++)
+        printf("%d: %s\n", keys[i], out[i] ? "found" : "not found");
+    printf("Found %lu of 8\n", (unsigned long)found);
+    binary_tree_delete(tree);
+    return (0);
+}
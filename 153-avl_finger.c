@@ -0,0 +1,27 @@
+#include "binary_trees.h"
+
+/**
+ * avl_finger_insert - Inserts a value into an AVL tree from a finger.
+ *
+ * @tree: A double pointer to the root node of the AVL tree.
+ * @finger: A pointer to a node of the tree, typically the last one
+ * inserted, or NULL to start from the root.
+ * @value: The value to insert.
+ *
+ * Return: A pointer to the created node, or NULL on failure or if
+ *         @value is already present.
+ *
+ * Description: The node is placed by bst_finger_insert, then the tree
+ * is rebalanced by avl_retrace. Every meta field of the tree must hold
+ * the node's height, as maintained by this function; a single node
+ * from binary_tree_node already does.
+ */
+avl_t *avl_finger_insert(avl_t **tree, avl_t *finger, int value)
+{
+	avl_t *node;
+
+	node = bst_finger_insert(tree, finger, value);
+	if (node != NULL)
+		avl_retrace(tree, node->parent, avl_update_height);
+	return (node);
+}
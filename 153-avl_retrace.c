@@ -0,0 +1,146 @@
+#include "binary_trees.h"
+
+/**
+ * avl_height - Reads the height stored in an AVL node.
+ *
+ * @node: A pointer to the node, may be NULL.
+ *
+ * Return: The number of edges on the longest path from @node down to a
+ *         leaf, kept in its meta field, or -1 if @node is NULL.
+ */
+int avl_height(const avl_t *node)
+{
+	return (node ? node->meta : -1);
+}
+
+/**
+ * avl_update_height - Recomputes the stored height of an AVL node.
+ *
+ * @node: A pointer to the node, whose children heights are up to date.
+ *
+ * Return: 1 if the height changed, 0 otherwise.
+ */
+int avl_update_height(avl_t *node)
+{
+	int left = avl_height(node->left), right = avl_height(node->right);
+	int old = node->meta;
+
+	node->meta = 1 + (left > right ? left : right);
+	return (node->meta != old);
+}
+
+/**
+ * avl_rotate - Rotates an AVL subtree and updates the moved nodes.
+ *
+ * @node: A pointer to the root node of the subtree.
+ * @left: 1 to rotate left, 0 to rotate right.
+ * @update: Function recomputing the data cached in a node from its
+ * children, avl_update_height for a plain AVL tree.
+ *
+ * Return: A pointer to the new subtree root.
+ */
+avl_t *avl_rotate(avl_t *node, int left, int (*update)(avl_t *))
+{
+	avl_t *pivot;
+
+	pivot = left ? binary_tree_rotate_left(node) :
+		binary_tree_rotate_right(node);
+	update(node);
+	update(pivot);
+	return (pivot);
+}
+
+/**
+ * avl_retrace - Restores the AVL balance from a node up to the root.
+ *
+ * @tree: A double pointer to the root node of the AVL tree.
+ * @node: A pointer to the lowest node whose subtree changed.
+ * @update: Function recomputing the data cached in a node (at least its
+ * height) from its children, returning whether it changed.
+ *
+ * Description: Each node on the way up is updated and rotated when its
+ * children heights differ by more than one. The walk stops at the first
+ * node left unchanged and balanced, as nothing above it can have
+ * changed. This costs O(1) per level since heights are read from the
+ * meta fields instead of being measured.
+ */
+void avl_retrace(avl_t **tree, avl_t *node, int (*update)(avl_t *))
+{
+	avl_t *child;
+	int changed, diff;
+
+	while (node != NULL)
+	{
+		changed = update(node);
+		diff = avl_height(node->left) - avl_height(node->right);
+		if (diff > 1)
+		{
+			child = node->left;
+			if (avl_height(child->left) < avl_height(child->right))
+				avl_rotate(child, 1, update);
+			node = avl_rotate(node, 0, update);
+			changed = 1;
+		}
+		else if (diff < -1)
+		{
+			child = node->right;
+			if (avl_height(child->right) < avl_height(child->left))
+				avl_rotate(child, 0, update);
+			node = avl_rotate(node, 1, update);
+			changed = 1;
+		}
+		if (node->parent == NULL)
+			*tree = node;
+		if (!changed)
+			break;
+		node = node->parent;
+	}
+}
+
+/**
+ * avl_unlink - Removes a node from an AVL tree and frees it.
+ *
+ * @tree: A double pointer to the root node of the AVL tree.
+ * @node: A pointer to the node to remove.
+ * @copy: Function copying the payload of an augmented node (besides its
+ * key) from its second argument into its first, or NULL if none.
+ * @update: Function recomputing the data cached in a node, as for
+ * avl_retrace.
+ *
+ * Description: A node with two children takes the key and payload of
+ * its in-order successor, which is removed instead. The node actually
+ * unlinked has at most one child, which takes its place before the tree
+ * is rebalanced from its parent up. avl_retrace may stop below the node
+ * that took the successor's payload, so that node and its ancestors are
+ * then updated until one is left unchanged. O(log n) overall.
+ */
+void avl_unlink(avl_t **tree, avl_t *node, void (*copy)(avl_t *, const avl_t *),
+		int (*update)(avl_t *))
+{
+	avl_t *child, *parent, *next, *moved = NULL;
+
+	if (node->left != NULL && node->right != NULL)
+	{
+		for (next = node->right; next->left != NULL;)
+			next = next->left;
+		node->n = next->n;
+		if (copy != NULL)
+			copy(node, next);
+		moved = node;
+		node = next;
+	}
+	child = node->left ? node->left : node->right;
+	parent = node->parent;
+	if (child != NULL)
+		child->parent = parent;
+	if (parent == NULL)
+		*tree = child;
+	else if (parent->left == node)
+		parent->left = child;
+	else
+		parent->right = child;
+	free(node);
+	avl_retrace(tree, parent, update);
+	while (moved != NULL && update(moved))
+		moved = moved->parent;
+}
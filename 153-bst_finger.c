@@ -0,0 +1,118 @@
+#include "binary_trees.h"
+
+/**
+ * bst_finger_climb - Climbs from a finger to a subtree holding a value.
+ *
+ * @finger: A pointer to a node of the BST.
+ * @value: The value to look for.
+ *
+ * Return: The lowest ancestor of @finger (or @finger itself) known to
+ *         hold the place of @value in its subtree.
+ *
+ * Description: Only ancestors reached through a link facing @value can
+ * bound it: each one either lies beyond @value, which ends the climb,
+ * or is passed and becomes the new starting point. Links on the other
+ * side change no bound, so the descent starts again from the last
+ * ancestor passed instead of from the top of the climb.
+ */
+bst_t *bst_finger_climb(bst_t *finger, int value)
+{
+	bst_t *node = finger, *start = finger, *parent;
+	int right = value > finger->n;
+
+	if (value == finger->n)
+		return (finger);
+	while ((parent = node->parent) != NULL)
+	{
+		if ((parent->left == node) == right)
+		{
+			if (parent->n == value)
+				return (parent);
+			if ((value < parent->n) == right)
+				break;
+			start = parent;
+		}
+		node = parent;
+	}
+	return (start);
+}
+
+/**
+ * bst_finger_locate - Descends from a subtree root towards a value.
+ *
+ * @node: A pointer to the node to start from, not NULL.
+ * @value: The value to look for.
+ * @parent: Address where the node @value would hang from is stored.
+ *
+ * Return: A pointer to the node holding @value, or NULL if there is none.
+ */
+bst_t *bst_finger_locate(bst_t *node, int value, bst_t **parent)
+{
+	*parent = NULL;
+	while (node != NULL && node->n != value)
+	{
+		*parent = node;
+		node = value < node->n ? node->left : node->right;
+	}
+	return (node);
+}
+
+/**
+ * bst_finger_search - Searches for a value starting from a finger.
+ *
+ * @finger: A pointer to a node of the BST, typically the last one
+ * visited.
+ * @value: The value to search for.
+ *
+ * Return: A pointer to the node holding @value, or NULL if @finger is
+ *         NULL or @value is not found.
+ *
+ * Description: Same result as bst_search from the root, but the search
+ * only climbs as far as needed before descending, so values close to
+ * the finger in key order are found in O(log d) on a balanced tree,
+ * where d is their distance from the finger.
+ */
+bst_t *bst_finger_search(bst_t *finger, int value)
+{
+	bst_t *parent;
+
+	if (finger == NULL)
+		return (NULL);
+	return (bst_finger_locate(bst_finger_climb(finger, value), value,
+				&parent));
+}
+
+/**
+ * bst_finger_insert - Inserts a value into a BST starting from a finger.
+ *
+ * @tree: A double pointer to the root node of the BST.
+ * @finger: A pointer to a node of the BST, typically the last one
+ * inserted, or NULL to start from the root.
+ * @value: The value to insert.
+ *
+ * Return: A pointer to the created node, or NULL on failure or if
+ *         @value is already present.
+ *
+ * Description: Places @value where bst_insert would, so feeding a
+ * nearly sorted stream with each new node as the next finger only pays
+ * for the distance between consecutive values.
+ */
+bst_t *bst_finger_insert(bst_t **tree, bst_t *finger, int value)
+{
+	bst_t *parent, *node;
+
+	if (tree == NULL)
+		return (NULL);
+	if (finger == NULL || *tree == NULL)
+		return (bst_insert(tree, value));
+	if (bst_finger_locate(bst_finger_climb(finger, value), value, &parent))
+		return (NULL);
+	node = binary_tree_node(parent, value);
+	if (node == NULL)
+		return (NULL);
+	if (value < parent->n)
+		parent->left = node;
+	else
+		parent->right = node;
+	return (node);
+}
@@ -0,0 +1,38 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    avl_t *tree, *finger, *node;
+    int stream[] = {
+        10, 20, 30, 25, 40, 50, 45, 60, 70, 65,
+        80, 90, 85, 100, 110, 105, 120, 130
+    };
+    size_t n = sizeof(stream) / sizeof(stream[0]), i;
+
+    tree = NULL;
+    finger = NULL;
+    for (i = 0; i < n; i++)
+    {
+        node = avl_finger_insert(&tree, finger, stream[i]);
+        if (node)
+            finger = node;
+    }
+    binary_tree_print(tree);
+    printf("Is AVL: %d, root height: %d\n", binary_tree_is_avl(tree),
+           tree->meta);
+    node = bst_finger_search(finger, 120);
+    printf("From %d, found %d\n", finger->n, node ? node->n : -1);
+    node = bst_finger_search(node, 45);
+    printf("From 120, found %d\n", node ? node->n : -1);
+    printf("From 45, 46 %s\n",
+           bst_finger_search(node, 46) ? "found" : "not found");
+    binary_tree_delete(tree);
+    return (0);
+}
@@ -0,0 +1,86 @@
+#include "binary_trees.h"
+
+/**
+ * bst_floor - Finds the greatest value of a BST not above a value.
+ *
+ * @tree: A pointer to the root node of the BST.
+ * @value: The value to compare with.
+ *
+ * Return: A pointer to the node holding the greatest value <= @value,
+ *         or NULL if there is none.
+ *
+ * Description: A single O(h) descent, remembering the last node passed
+ * on its right.
+ */
+bst_t *bst_floor(const bst_t *tree, int value)
+{
+	const bst_t *best = NULL;
+
+	while (tree != NULL && tree->n != value)
+	{
+		if (tree->n < value)
+		{
+			best = tree;
+			tree = tree->right;
+		}
+		else
+			tree = tree->left;
+	}
+	return ((bst_t *)(tree ? tree : best));
+}
+
+/**
+ * bst_ceiling - Finds the lowest value of a BST not below a value.
+ *
+ * @tree: A pointer to the root node of the BST.
+ * @value: The value to compare with.
+ *
+ * Return: A pointer to the node holding the lowest value >= @value,
+ *         or NULL if there is none.
+ */
+bst_t *bst_ceiling(const bst_t *tree, int value)
+{
+	const bst_t *best = NULL;
+
+	while (tree != NULL && tree->n != value)
+	{
+		if (tree->n > value)
+		{
+			best = tree;
+			tree = tree->left;
+		}
+		else
+			tree = tree->right;
+	}
+	return ((bst_t *)(tree ? tree : best));
+}
+
+/**
+ * bst_floor_many - Finds the floor of many values at once.
+ *
+ * @tree: A pointer to the root node of the BST.
+ * @values: The values to compare with.
+ * @count: The number of values.
+ * @out: Array receiving, for each value, the same node as bst_floor.
+ */
+void bst_floor_many(const bst_t *tree, const int *values, size_t count,
+		bst_t **out)
+{
+	if (values != NULL && out != NULL)
+		bst_walk_many(tree, values, count, out, SEARCH_FLOOR);
+}
+
+/**
+ * bst_ceiling_many - Finds the ceiling of many values at once.
+ *
+ * @tree: A pointer to the root node of the BST.
+ * @values: The values to compare with.
+ * @count: The number of values.
+ * @out: Array receiving, for each value, the same node as bst_ceiling.
+ */
+void bst_ceiling_many(const bst_t *tree, const int *values, size_t count,
+		bst_t **out)
+{
+	if (values != NULL && out != NULL)
+		bst_walk_many(tree, values, count, out, SEARCH_CEILING);
+}
@@ -0,0 +1,73 @@
+#include "binary_trees.h"
+
+/**
+ * bst_min - Finds the lowest value of a BST.
+ *
+ * @tree: A pointer to the root node of the BST.
+ *
+ * Return: A pointer to the node holding the lowest value, or NULL if
+ *         @tree is NULL.
+ */
+bst_t *bst_min(const bst_t *tree)
+{
+	while (tree != NULL && tree->left != NULL)
+		tree = tree->left;
+	return ((bst_t *)tree);
+}
+
+/**
+ * bst_max - Finds the greatest value of a BST.
+ *
+ * @tree: A pointer to the root node of the BST.
+ *
+ * Return: A pointer to the node holding the greatest value, or NULL if
+ *         @tree is NULL.
+ */
+bst_t *bst_max(const bst_t *tree)
+{
+	while (tree != NULL && tree->right != NULL)
+		tree = tree->right;
+	return ((bst_t *)tree);
+}
+
+/**
+ * bst_successor - Finds the next node of a BST in order.
+ *
+ * @node: A pointer to a node of the BST.
+ *
+ * Return: A pointer to the node holding the next greater value, or NULL
+ *         if @node is NULL or holds the greatest value.
+ *
+ * Description: Either the lowest node of the right subtree, or the first
+ * ancestor reached from its left side, found through the parent
+ * pointers in O(h) without a stack.
+ */
+bst_t *bst_successor(const bst_t *node)
+{
+	if (node == NULL)
+		return (NULL);
+	if (node->right != NULL)
+		return (bst_min(node->right));
+	while (node->parent != NULL && node->parent->right == node)
+		node = node->parent;
+	return (node->parent);
+}
+
+/**
+ * bst_predecessor - Finds the previous node of a BST in order.
+ *
+ * @node: A pointer to a node of the BST.
+ *
+ * Return: A pointer to the node holding the next lower value, or NULL
+ *         if @node is NULL or holds the lowest value.
+ */
+bst_t *bst_predecessor(const bst_t *node)
+{
+	if (node == NULL)
+		return (NULL);
+	if (node->left != NULL)
+		return (bst_max(node->left));
+	while (node->parent != NULL && node->parent->left == node)
+		node = node->parent;
+	return (node->parent);
+}
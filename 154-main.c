@@ -0,0 +1,55 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_node - Prints the value of a node, or NIL
+ *
+ * @label: Text printed before the value
+ * @node: Pointer to the node to print, may be NULL
+ */
+void print_node(const char *label, const bst_t *node)
+{
+    if (node)
+        printf("%s%d", label, node->n);
+    else
+        printf("%sNIL", label);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *tree, *floors[5], *ceilings[5];
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    int probes[] = {0, 33, 68, 90, 99};
+    size_t n = sizeof(array) / sizeof(array[0]), i;
+
+    tree = array_to_bst(array, n);
+    if (!tree)
+        return (1);
+    binary_tree_print(tree);
+    print_node("Min: ", bst_min(tree));
+    print_node(", max: ", bst_max(tree));
+    print_node("\nBefore 79: ", bst_predecessor(tree));
+    print_node(", after 79: ", bst_successor(tree));
+    printf("\n");
+    bst_floor_many(tree, probes, 5, floors);
+    bst_ceiling_many(tree, probes, 5, ceilings);
+    for (i = 0; i < 5; i++)
+    {
+        printf("%d:", probes[i]);
+        print_node(" floor ", bst_floor(tree, probes[i]));
+        print_node(", ceiling ", bst_ceiling(tree, probes[i]));
+        printf(" (batched: %s)\n", floors[i] == bst_floor(tree, probes[i]) &&
+               ceilings[i] == bst_ceiling(tree, probes[i]) ? "same" : "differ");
+    }
+    binary_tree_delete(tree);
+    return (0);
+}
@@ -0,0 +1,40 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    avl_t *tree, *node;
+    int events[] = {
+        5, 3, 8, 5, 5, 1, 8, 9, 3, 5, 7, 1, 5, 2
+    };
+    size_t n = sizeof(events) / sizeof(events[0]), i;
+
+    tree = NULL;
+    for (i = 0; i < n; i++)
+        mset_insert(&tree, events[i]);
+    binary_tree_print(tree);
+    printf("Occurrences: %lu, distinct: %lu\n",
+           (unsigned long)mset_total(tree),
+           (unsigned long)binary_tree_size(tree));
+    printf("Count of 5: %lu, rank of 5: %lu, in [2, 7]: %lu\n",
+           (unsigned long)mset_count(tree, 5),
+           (unsigned long)mset_rank(tree, 5),
+           (unsigned long)mset_range_count(tree, 2, 7));
+    node = mset_select(tree, 7);
+    printf("Occurrence #7 (from 0): %d\n", node ? node->n : -1);
+
+    mset_remove(&tree, 5);
+    mset_remove(&tree, 9);
+    mset_remove(&tree, 2);
+    printf("Removed one 5, 9 and 2: count of 5: %lu, is AVL: %d\n",
+           (unsigned long)mset_count(tree, 5), binary_tree_is_avl(tree));
+    binary_tree_print(tree);
+    binary_tree_delete(tree);
+    return (0);
+}
@@ -0,0 +1,111 @@
+#include "binary_trees.h"
+
+/**
+ * mset_total - Reads the number of occurrences in a multiset subtree.
+ *
+ * @node: A pointer to the root node of the subtree, may be NULL.
+ *
+ * Return: The occurrences of every key of the subtree, or 0 if @node
+ *         is NULL.
+ */
+size_t mset_total(const avl_t *node)
+{
+	return (node ? ((const mset_node_t *)node)->total : 0);
+}
+
+/**
+ * mset_update - Recomputes the height and total of a multiset node.
+ *
+ * @node: A pointer to the node, whose children are up to date.
+ *
+ * Return: 1 if the height or the total changed, 0 otherwise.
+ */
+int mset_update(avl_t *node)
+{
+	mset_node_t *m = (mset_node_t *)node;
+	size_t old = m->total;
+	int changed = avl_update_height(node);
+
+	m->total = m->count + mset_total(node->left) + mset_total(node->right);
+	return (changed || m->total != old);
+}
+
+/**
+ * mset_node - Creates a multiset node holding one occurrence of a key.
+ *
+ * @parent: A pointer to the parent node.
+ * @value: The key to store.
+ *
+ * Return: A pointer to the AVL node embedded in the new multiset node,
+ *         or NULL on failure.
+ */
+avl_t *mset_node(avl_t *parent, int value)
+{
+	mset_node_t *m;
+
+	m = (mset_node_t *)binary_tree_node_size(parent, value, sizeof(*m));
+	if (m == NULL)
+		return (NULL);
+	m->count = 1;
+	m->total = 1;
+	return (&m->avl);
+}
+
+/**
+ * mset_insert - Adds one occurrence of a value to a multiset.
+ *
+ * @tree: A double pointer to the root node of the multiset.
+ * @value: The value to add.
+ *
+ * Return: A pointer to the node holding @value, or NULL on failure.
+ *
+ * Description: A value already present only gets its count and the
+ * totals above it incremented. A new value gets a node with a count of
+ * one, and the tree is rebalanced by avl_retrace, in O(log n) where n
+ * is the number of distinct values.
+ */
+avl_t *mset_insert(avl_t **tree, int value)
+{
+	avl_t *node, *parent = NULL;
+
+	if (tree == NULL)
+		return (NULL);
+	for (node = *tree; node != NULL && node->n != value;)
+	{
+		parent = node;
+		node = value < node->n ? node->left : node->right;
+	}
+	if (node != NULL)
+	{
+		((mset_node_t *)node)->count++;
+		for (parent = node; parent != NULL; parent = parent->parent)
+			((mset_node_t *)parent)->total++;
+		return (node);
+	}
+	node = mset_node(parent, value);
+	if (node == NULL)
+		return (NULL);
+	if (parent == NULL)
+		return (*tree = node);
+	if (value < parent->n)
+		parent->left = node;
+	else
+		parent->right = node;
+	avl_retrace(tree, parent, mset_update);
+	return (node);
+}
+
+/**
+ * mset_count - Counts the occurrences of a value in a multiset.
+ *
+ * @tree: A pointer to the root node of the multiset.
+ * @value: The value to count.
+ *
+ * Return: The number of occurrences of @value.
+ */
+size_t mset_count(const avl_t *tree, int value)
+{
+	while (tree != NULL && tree->n != value)
+		tree = value < tree->n ? tree->left : tree->right;
+	return (tree ? ((const mset_node_t *)tree)->count : 0);
+}
@@ -0,0 +1,89 @@
+#include "binary_trees.h"
+
+/**
+ * mset_below - Counts the occurrences of a multiset below a value.
+ *
+ * @tree: A pointer to the root node of the multiset.
+ * @value: The value to compare with.
+ * @inclusive: 1 to count the occurrences of @value too, 0 otherwise.
+ *
+ * Return: The number of occurrences lower than (or equal to) @value.
+ *
+ * Description: Every node passed on its right side adds its count and
+ * the total of its left subtree, in one O(log n) descent.
+ */
+size_t mset_below(const avl_t *tree, int value, int inclusive)
+{
+	size_t count = 0;
+
+	while (tree != NULL)
+	{
+		if (tree->n < value || (inclusive && tree->n == value))
+		{
+			count += mset_total(tree->left) +
+				((const mset_node_t *)tree)->count;
+			tree = tree->right;
+		}
+		else
+			tree = tree->left;
+	}
+	return (count);
+}
+
+/**
+ * mset_rank - Ranks a value in a multiset.
+ *
+ * @tree: A pointer to the root node of the multiset.
+ * @value: The value to rank.
+ *
+ * Return: The number of occurrences of values lower than @value.
+ */
+size_t mset_rank(const avl_t *tree, int value)
+{
+	return (mset_below(tree, value, 0));
+}
+
+/**
+ * mset_range_count - Counts the occurrences of a multiset in a range.
+ *
+ * @tree: A pointer to the root node of the multiset.
+ * @lo: The lowest value of the range.
+ * @hi: The greatest value of the range.
+ *
+ * Return: The number of occurrences of values in [@lo, @hi].
+ */
+size_t mset_range_count(const avl_t *tree, int lo, int hi)
+{
+	if (lo > hi)
+		return (0);
+	return (mset_below(tree, hi, 1) - mset_below(tree, lo, 0));
+}
+
+/**
+ * mset_select - Finds the occurrence of a multiset at a given rank.
+ *
+ * @tree: A pointer to the root node of the multiset.
+ * @rank: The number of occurrences before the one wanted, from 0.
+ *
+ * Return: A pointer to the node holding that occurrence, or NULL if
+ *         @rank is not below the total number of occurrences.
+ */
+avl_t *mset_select(const avl_t *tree, size_t rank)
+{
+	size_t left;
+
+	while (tree != NULL)
+	{
+		left = mset_total(tree->left);
+		if (rank < left)
+			tree = tree->left;
+		else if (rank < left + ((const mset_node_t *)tree)->count)
+			return ((avl_t *)tree);
+		else
+		{
+			rank -= left + ((const mset_node_t *)tree)->count;
+			tree = tree->right;
+		}
+	}
+	return (NULL);
+}
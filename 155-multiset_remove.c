@@ -0,0 +1,45 @@
+#include "binary_trees.h"
+
+/**
+ * mset_copy - Copies the count of a multiset node into another one.
+ *
+ * @dst: A pointer to the node taking the key of @src.
+ * @src: A pointer to the node whose key moves, about to be removed.
+ */
+void mset_copy(avl_t *dst, const avl_t *src)
+{
+	((mset_node_t *)dst)->count = ((const mset_node_t *)src)->count;
+}
+
+/**
+ * mset_remove - Removes one occurrence of a value from a multiset.
+ *
+ * @tree: A double pointer to the root node of the multiset.
+ * @value: The value to remove.
+ *
+ * Return: 1 if an occurrence was removed, 0 if @value is not present.
+ *
+ * Description: The node goes away with its last occurrence, through
+ * avl_unlink with mset_copy and mset_update; until then, only its count
+ * and the totals above it are decremented.
+ */
+int mset_remove(avl_t **tree, int value)
+{
+	avl_t *node;
+
+	if (tree == NULL)
+		return (0);
+	for (node = *tree; node != NULL && node->n != value;)
+		node = value < node->n ? node->left : node->right;
+	if (node == NULL)
+		return (0);
+	if (((mset_node_t *)node)->count == 1)
+	{
+		avl_unlink(tree, node, mset_copy, mset_update);
+		return (1);
+	}
+	((mset_node_t *)node)->count--;
+	for (; node != NULL; node = node->parent)
+		((mset_node_t *)node)->total--;
+	return (1);
+}
@@ -0,0 +1,154 @@
+#include "binary_trees.h"
+
+/**
+ * avl_join_side - Hangs a short AVL tree and a pivot inside a taller one.
+ *
+ * @tall: A pointer to the root node of the taller tree.
+ * @pivot: A pointer to the detached node going between both trees.
+ * @small: A pointer to the root node of the shorter tree, may be NULL.
+ * @right: 1 if @tall holds the lower values, 0 if it holds the upper.
+ *
+ * Return: A pointer to the root node of the joined tree.
+ *
+ * Description: Walks down the spine of @tall facing @small to the first
+ * node no more than one level taller than @small. That node and @small
+ * become the children of @pivot, which takes its place, and the tree is
+ * rebalanced from there up.
+ */
+avl_t *avl_join_side(avl_t *tall, avl_t *pivot, avl_t *small, int right)
+{
+	avl_t *node = tall, *parent = NULL;
+
+	while (avl_height(node) > avl_height(small) + 1)
+	{
+		parent = node;
+		node = right ? node->right : node->left;
+	}
+	pivot->left = right ? node : small;
+	pivot->right = right ? small : node;
+	if (node != NULL)
+		node->parent = pivot;
+	if (small != NULL)
+		small->parent = pivot;
+	pivot->parent = parent;
+	if (right)
+		parent->right = pivot;
+	else
+		parent->left = pivot;
+	avl_update_height(pivot);
+	avl_retrace(&tall, parent, avl_update_height);
+	return (tall);
+}
+
+/**
+ * avl_pop_max - Detaches the greatest node of an AVL tree.
+ *
+ * @tree: A double pointer to the root node of a non-empty AVL tree.
+ *
+ * Return: A pointer to the detached node.
+ */
+avl_t *avl_pop_max(avl_t **tree)
+{
+	avl_t *node = *tree, *parent;
+
+	while (node->right != NULL)
+		node = node->right;
+	parent = node->parent;
+	if (node->left != NULL)
+		node->left->parent = parent;
+	if (parent == NULL)
+		*tree = node->left;
+	else
+	{
+		parent->right = node->left;
+		avl_retrace(tree, parent, avl_update_height);
+	}
+	node->parent = NULL;
+	node->left = NULL;
+	node->meta = 0;
+	return (node);
+}
+
+/**
+ * avl_join - Joins two AVL trees.
+ *
+ * @lo: A pointer to the root node of the lower tree, may be NULL.
+ * @pivot: A pointer to a detached node greater than every value of @lo
+ * and lower than every value of @hi, or NULL to use the greatest node
+ * of @lo.
+ * @hi: A pointer to the root node of the upper tree, may be NULL.
+ *
+ * Return: A pointer to the root node of the joined tree.
+ *
+ * Description: Costs O(|height(lo) - height(hi)| + 1), so O(log n).
+ * Every meta field must hold the node's height, as maintained by
+ * avl_finger_insert, avl_split and this function. All inputs are
+ * consumed.
+ */
+avl_t *avl_join(avl_t *lo, avl_t *pivot, avl_t *hi)
+{
+	int diff;
+
+	if (pivot == NULL)
+	{
+		if (lo == NULL)
+			return (hi);
+		pivot = avl_pop_max(&lo);
+	}
+	if (lo != NULL)
+		lo->parent = NULL;
+	if (hi != NULL)
+		hi->parent = NULL;
+	diff = avl_height(lo) - avl_height(hi);
+	if (diff > 1)
+		return (avl_join_side(lo, pivot, hi, 1));
+	if (diff < -1)
+		return (avl_join_side(hi, pivot, lo, 0));
+	pivot->parent = NULL;
+	pivot->left = lo;
+	pivot->right = hi;
+	if (lo != NULL)
+		lo->parent = pivot;
+	if (hi != NULL)
+		hi->parent = pivot;
+	avl_update_height(pivot);
+	return (pivot);
+}
+
+/**
+ * avl_split - Splits an AVL tree around a key.
+ *
+ * @root: A pointer to the root node of the AVL tree to split.
+ * @key: The splitting key.
+ * @lo: Address where the tree of the values lower than @key is stored.
+ * @hi: Address where the tree of the other values is stored.
+ *
+ * Description: Each node on the search path of @key is joined, with
+ * its subtree on the other side, to the part it belongs to. The joins
+ * telescope to O(log n) overall. @root is consumed.
+ */
+void avl_split(avl_t *root, int key, avl_t **lo, avl_t **hi)
+{
+	avl_t *left, *right, *sub;
+
+	*lo = NULL;
+	*hi = NULL;
+	if (root == NULL)
+		return;
+	left = root->left;
+	right = root->right;
+	if (left != NULL)
+		left->parent = NULL;
+	if (right != NULL)
+		right->parent = NULL;
+	if (key <= root->n)
+	{
+		avl_split(left, key, lo, &sub);
+		*hi = avl_join(sub, root, right);
+	}
+	else
+	{
+		avl_split(right, key, &sub, hi);
+		*lo = avl_join(left, root, sub);
+	}
+}
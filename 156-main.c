@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    avl_t *tree, *finger, *lo, *hi;
+    int i;
+
+    tree = NULL;
+    finger = NULL;
+    for (i = 1; i <= 20; i++)
+        finger = avl_finger_insert(&tree, finger, i * 10);
+    binary_tree_print(tree);
+
+    avl_split(tree, 65, &lo, &hi);
+    printf("Shard below 65 (AVL: %d):\n", binary_tree_is_avl(lo));
+    binary_tree_print(lo);
+    printf("Shard from 65 (AVL: %d):\n", binary_tree_is_avl(hi));
+    binary_tree_print(hi);
+
+    tree = avl_join(lo, binary_tree_node(NULL, 65), hi);
+    printf("Joined back with 65 (AVL: %d):\n", binary_tree_is_avl(tree));
+    binary_tree_print(tree);
+    binary_tree_delete(tree);
+    return (0);
+}
@@ -0,0 +1,132 @@
+#include "binary_trees.h"
+#include "limits.h"
+
+/**
+ * bst_cut - Splits a BST around a key without rebalancing.
+ *
+ * @root: A pointer to the root node of the BST to split.
+ * @key: The splitting key.
+ * @lo: Address where the tree of the values lower than @key is stored.
+ * @hi: Address where the tree of the other values is stored.
+ *
+ * Description: Walks the search path of @key once, hooking each node
+ * below the last lower node or the last upper node met, in O(h) without
+ * recursion. Neither part gets taller than @root was.
+ */
+void bst_cut(bst_t *root, int key, bst_t **lo, bst_t **hi)
+{
+	bst_t **lo_hook = lo, **hi_hook = hi, *lo_last = NULL, *hi_last = NULL;
+
+	while (root != NULL)
+	{
+		if (root->n < key)
+		{
+			*lo_hook = root;
+			root->parent = lo_last;
+			lo_last = root;
+			lo_hook = &root->right;
+			root = root->right;
+		}
+		else
+		{
+			*hi_hook = root;
+			root->parent = hi_last;
+			hi_last = root;
+			hi_hook = &root->left;
+			root = root->left;
+		}
+	}
+	*lo_hook = NULL;
+	*hi_hook = NULL;
+}
+
+/**
+ * bst_delete_flat - Frees a binary tree without recursion.
+ *
+ * @tree: A pointer to the root node of the tree to free.
+ *
+ * Description: Rotates left children up until the current node has
+ * none, then frees it and moves right, so any shape is freed in O(n)
+ * time and O(1) memory.
+ */
+void bst_delete_flat(bst_t *tree)
+{
+	bst_t *next;
+
+	while (tree != NULL)
+	{
+		if (tree->left != NULL)
+		{
+			next = tree->left;
+			tree->left = next->right;
+			next->right = tree;
+		}
+		else
+		{
+			next = tree->right;
+			free(tree);
+		}
+		tree = next;
+	}
+}
+
+/**
+ * bst_remove_range - Removes every value of a BST within a range.
+ *
+ * @root: A pointer to the root node of the BST.
+ * @lo: The lowest value to remove.
+ * @hi: The greatest value to remove.
+ *
+ * Return: A pointer to the new root node of the BST.
+ *
+ * Description: Cuts the tree at @lo and past @hi, frees the middle part
+ * in one pass and hangs the upper part below the greatest node of the
+ * lower part, in O(k + h) for k removed nodes. The tree is not
+ * rebalanced; use avl_remove_range to keep an AVL tree balanced.
+ */
+bst_t *bst_remove_range(bst_t *root, int lo, int hi)
+{
+	bst_t *low, *mid, *high = NULL, *last;
+
+	if (lo > hi)
+		return (root);
+	bst_cut(root, lo, &low, &mid);
+	if (hi != INT_MAX)
+		bst_cut(mid, hi + 1, &mid, &high);
+	bst_delete_flat(mid);
+	if (low == NULL)
+		return (high);
+	for (last = low; last->right != NULL;)
+		last = last->right;
+	last->right = high;
+	if (high != NULL)
+		high->parent = last;
+	return (low);
+}
+
+/**
+ * avl_remove_range - Removes every value of an AVL tree within a range.
+ *
+ * @root: A pointer to the root node of the AVL tree.
+ * @lo: The lowest value to remove.
+ * @hi: The greatest value to remove.
+ *
+ * Return: A pointer to the new root node of the AVL tree.
+ *
+ * Description: Splits the tree at @lo and past @hi with avl_split,
+ * frees the middle part in one pass and joins the outer parts back with
+ * a single avl_join, in O(k + log n) for k removed nodes. The meta
+ * fields must hold the node heights, as for avl_split.
+ */
+avl_t *avl_remove_range(avl_t *root, int lo, int hi)
+{
+	avl_t *low, *mid, *high = NULL;
+
+	if (lo > hi)
+		return (root);
+	avl_split(root, lo, &low, &mid);
+	if (hi != INT_MAX)
+		avl_split(mid, hi + 1, &mid, &high);
+	bst_delete_flat(mid);
+	return (avl_join(low, NULL, high));
+}
@@ -0,0 +1,55 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * is_multiple - Predicate matching the multiples of a divisor
+ *
+ * @value: The value to test
+ * @ctx: A pointer to the divisor
+ *
+ * Return: 1 if @value is a multiple of the divisor, 0 otherwise
+ */
+int is_multiple(int value, void *ctx)
+{
+    return (value % *(int *)ctx == 0);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    avl_t *tree, *finger;
+    bst_t *bst;
+    int i, divisor;
+
+    tree = NULL;
+    finger = NULL;
+    bst = NULL;
+    for (i = 1; i <= 20; i++)
+    {
+        finger = avl_finger_insert(&tree, finger, i * 10);
+        bst_insert(&bst, (i * 7) % 20 * 10);
+    }
+    binary_tree_print(tree);
+
+    tree = avl_remove_range(tree, 45, 125);
+    printf("AVL without [45, 125] (AVL: %d):\n", binary_tree_is_avl(tree));
+    binary_tree_print(tree);
+
+    divisor = 30;
+    tree = tree_remove_if(tree, is_multiple, &divisor);
+    printf("Without multiples of 30 (AVL: %d):\n", binary_tree_is_avl(tree));
+    binary_tree_print(tree);
+    binary_tree_delete(tree);
+
+    binary_tree_print(bst);
+    bst = bst_remove_range(bst, 50, 140);
+    printf("BST without [50, 140] (BST: %d):\n", binary_tree_is_bst(bst));
+    binary_tree_print(bst);
+    binary_tree_delete(bst);
+    return (0);
+}
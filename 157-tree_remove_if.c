@@ -0,0 +1,66 @@
+#include "binary_trees.h"
+
+/**
+ * avl_set_heights - Stores the height of every node of a tree.
+ *
+ * @tree: A pointer to the root node of the tree.
+ *
+ * Return: The height of @tree, -1 if it is NULL.
+ */
+int avl_set_heights(avl_t *tree)
+{
+	int left, right;
+
+	if (tree == NULL)
+		return (-1);
+	left = avl_set_heights(tree->left);
+	right = avl_set_heights(tree->right);
+	tree->meta = 1 + (left > right ? left : right);
+	return (tree->meta);
+}
+
+/**
+ * tree_remove_if - Removes every node of a BST matching a predicate.
+ *
+ * @root: A pointer to the root node of the BST or AVL tree.
+ * @pred: Function called with each value and @ctx, returning nonzero
+ * for the values to remove.
+ * @ctx: Caller data handed to @pred.
+ *
+ * Return: A pointer to the root node of the remaining tree.
+ *
+ * Description: Flattens the tree into a sorted vine in place, frees the
+ * matching nodes in a single walk along it, then rebuilds the survivors
+ * once with bst_rebalance. The result is a complete BST whose meta
+ * fields hold the node heights, so it is also a valid AVL tree for
+ * avl_split, avl_join and avl_finger_insert. O(n) time, O(1) memory,
+ * instead of one removal and rebalance per matching node.
+ */
+bst_t *tree_remove_if(bst_t *root, int (*pred)(int, void *), void *ctx)
+{
+	bst_t *node, *next, *head = NULL, *last = NULL;
+	size_t size;
+
+	if (root == NULL || pred == NULL)
+		return (root);
+	for (node = bst_tree_to_vine(root, &size); node != NULL; node = next)
+	{
+		next = node->right;
+		if (pred(node->n, ctx))
+		{
+			free(node);
+			continue;
+		}
+		node->parent = last;
+		if (last == NULL)
+			head = node;
+		else
+			last->right = node;
+		last = node;
+	}
+	if (last != NULL)
+		last->right = NULL;
+	root = bst_rebalance(head);
+	avl_set_heights(root);
+	return (root);
+}
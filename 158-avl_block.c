@@ -0,0 +1,99 @@
+#include <pthread.h>
+#include "binary_trees.h"
+
+/**
+ * avl_block_task - Fills one subtree of a contiguous AVL tree, as a
+ * thread body.
+ *
+ * @arg: A pointer to the avl_block_task_t to run.
+ *
+ * Return: Always NULL.
+ */
+void *avl_block_task(void *arg)
+{
+	avl_block_fill(arg);
+	return (NULL);
+}
+
+/**
+ * avl_block_fill - Fills the nodes of a subtree from its sorted values.
+ *
+ * @task: A pointer to the subtree to fill.
+ *
+ * Description: The middle value, picked as by sorted_array_to_avl, goes
+ * to the first node of the block, then the left subtree fills the next
+ * (size - 1) / 2 nodes and the right subtree the rest. The height of a
+ * subtree built this way is floor(log2(size)), so each node gets its
+ * cached height without waiting for its children. While @task->splits
+ * allows it, a left subtree of at least AVL_BLOCK_GRAIN nodes runs on a
+ * new thread while the calling thread fills the right one.
+ */
+void avl_block_fill(avl_block_task_t *task)
+{
+	avl_block_task_t half[2];
+	avl_t *node = task->block;
+	size_t mid = (task->size - 1) / 2;
+	pthread_t thread;
+	int height = 0, i;
+
+	while (task->size >> (height + 1))
+		height++;
+	node->n = task->array[mid];
+	node->meta = height;
+	node->parent = task->parent;
+	node->left = mid ? node + 1 : NULL;
+	node->right = task->size - mid - 1 ? node + 1 + mid : NULL;
+	for (i = 0; i < 2; i++)
+	{
+		half[i].array = i ? task->array + mid + 1 : task->array;
+		half[i].size = i ? task->size - mid - 1 : mid;
+		half[i].parent = node;
+		half[i].block = i ? node + 1 + mid : node + 1;
+		half[i].splits = task->splits - 1;
+	}
+	if (task->splits > 0 && mid >= AVL_BLOCK_GRAIN &&
+		pthread_create(&thread, NULL, avl_block_task, &half[0]) == 0)
+	{
+		avl_block_fill(&half[1]);
+		pthread_join(thread, NULL);
+		return;
+	}
+	for (i = 0; i < 2; i++)
+		if (half[i].size)
+			avl_block_fill(&half[i]);
+}
+
+/**
+ * sorted_array_to_avl_block - Builds an AVL tree from a sorted array
+ * into a single block of nodes.
+ *
+ * @array: A pointer to the first element of the sorted array.
+ * @size: The number of elements in @array.
+ *
+ * Return: A pointer to the root node of the created AVL tree, or NULL
+ *         on failure.
+ *
+ * Description: Same shape as sorted_array_to_avl, with parent pointers
+ * and heights set, but with one allocation instead of one per node and
+ * the upper AVL_BLOCK_SPLITS levels built on up to 2^AVL_BLOCK_SPLITS
+ * threads. The nodes are laid out in preorder, so the root is the start
+ * of the block. The tree can be searched and walked like any other but
+ * its nodes must not be removed, and it is freed with bst_bulk_delete
+ * instead of binary_tree_delete.
+ */
+avl_t *sorted_array_to_avl_block(const int *array, size_t size)
+{
+	avl_block_task_t task;
+
+	if (array == NULL || size == 0)
+		return (NULL);
+	task.block = malloc(sizeof(*task.block) * size);
+	if (task.block == NULL)
+		return (NULL);
+	task.array = array;
+	task.size = size;
+	task.parent = NULL;
+	task.splits = AVL_BLOCK_SPLITS;
+	avl_block_fill(&task);
+	return (task.block);
+}
@@ -0,0 +1,92 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/*
+ * gcc -O2 -pthread 158-bench.c 158-avl_block.c 124-sorted_array_to_avl.c
+ *     149-bst_bulk.c 153-avl_retrace.c 103-binary_tree_rotate_left.c
+ *     104-binary_tree_rotate_right.c 3-binary_tree_delete.c
+ *     0-binary_tree_node.c -o 158-bench
+ *
+ * ./158-bench [max_exponent], sizes 10^5 up to 10^max_exponent (default 7)
+ */
+
+/**
+ * seconds - Reads a monotonic clock
+ *
+ * Return: The current time in seconds
+ */
+double seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec + now.tv_nsec / 1e9);
+}
+
+/**
+ * bench_size - Times both builders, and freeing their trees
+ *
+ * @keys: Sorted array of at least n keys
+ * @n: Number of keys
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int bench_size(const int *keys, size_t n)
+{
+    avl_t *tree;
+    double start, build, release;
+
+    start = seconds();
+    tree = sorted_array_to_avl((int *)keys, n);
+    build = seconds() - start;
+    if (!tree)
+        return (1);
+    start = seconds();
+    binary_tree_delete(tree);
+    release = seconds() - start;
+    printf("%9lu keys, sorted_array_to_avl       %.3fs + free %.3fs\n",
+           (unsigned long)n, build, release);
+    start = seconds();
+    tree = sorted_array_to_avl_block(keys, n);
+    build = seconds() - start;
+    if (!tree)
+        return (1);
+    start = seconds();
+    bst_bulk_delete(tree);
+    release = seconds() - start;
+    printf("%9lu keys, sorted_array_to_avl_block %.3fs + free %.3fs\n",
+           (unsigned long)n, build, release);
+    return (0);
+}
+
+/**
+ * main - Benchmarks sorted_array_to_avl_block against sorted_array_to_avl
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments, the optional largest power of ten to measure
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int argc, char **argv)
+{
+    int max = argc > 1 ? atoi(argv[1]) : 7, e, *keys;
+    size_t i, n = 10000, top = 1;
+
+    for (e = 0; e < max; e++)
+        top *= 10;
+    keys = malloc(sizeof(*keys) * top);
+    if (!keys)
+        return (1);
+    for (i = 0; i < top; i++)
+        keys[i] = (int)i;
+    for (e = 5; e <= max; e++)
+    {
+        n *= 10;
+        if (bench_size(keys, n))
+            break;
+    }
+    free(keys);
+    return (0);
+}
@@ -0,0 +1,28 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    avl_t *tree;
+    int array[] = {
+        1, 2, 20, 21, 22, 32, 34, 47, 62, 68,
+        79, 84, 87, 91, 95, 98
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+
+    tree = sorted_array_to_avl_block(array, n);
+    if (!tree)
+        return (1);
+    binary_tree_print(tree);
+    printf("AVL: %d, root height: %d, parent of %d: %d\n",
+           binary_tree_is_avl(tree), tree->meta, tree->left->right->n,
+           tree->left->right->parent->n);
+    bst_bulk_delete(tree);
+    return (0);
+}
@@ -0,0 +1,125 @@
+#include "binary_trees.h"
+
+/**
+ * agg_of - Reads the aggregate of an aggregate AVL subtree.
+ *
+ * @node: A pointer to the root node of the subtree, may be NULL.
+ *
+ * Return: A pointer to the aggregate of the subtree, or NULL if @node
+ *         is NULL.
+ */
+const agg_t *agg_of(const avl_t *node)
+{
+	return (node ? &((const agg_node_t *)node)->agg : NULL);
+}
+
+/**
+ * agg_merge - Adds an aggregate into another one.
+ *
+ * @acc: A pointer to the aggregate to update.
+ * @add: A pointer to the aggregate to add, may be NULL.
+ */
+void agg_merge(agg_t *acc, const agg_t *add)
+{
+	if (add == NULL || add->count == 0)
+		return;
+	acc->sum += add->sum;
+	if (add->min < acc->min)
+		acc->min = add->min;
+	if (add->max > acc->max)
+		acc->max = add->max;
+	acc->count += add->count;
+}
+
+/**
+ * agg_update - Recomputes the height and aggregate of a node.
+ *
+ * @node: A pointer to the node, whose children are up to date.
+ *
+ * Return: 1 if the height or the aggregate changed, 0 otherwise.
+ */
+int agg_update(avl_t *node)
+{
+	agg_node_t *a = (agg_node_t *)node;
+	agg_t old = a->agg;
+	int changed = avl_update_height(node);
+
+	a->agg.sum = a->value;
+	a->agg.min = a->value;
+	a->agg.max = a->value;
+	a->agg.count = 1;
+	agg_merge(&a->agg, agg_of(node->left));
+	agg_merge(&a->agg, agg_of(node->right));
+	return (changed || old.sum != a->agg.sum || old.min != a->agg.min ||
+			old.max != a->agg.max || old.count != a->agg.count);
+}
+
+/**
+ * agg_node - Creates an aggregate AVL node.
+ *
+ * @parent: A pointer to the parent node.
+ * @key: The key to store.
+ * @value: The value stored under @key.
+ *
+ * Return: A pointer to the AVL node embedded in the new node, or NULL
+ *         on failure.
+ */
+avl_t *agg_node(avl_t *parent, int key, int value)
+{
+	agg_node_t *a;
+
+	a = (agg_node_t *)binary_tree_node_size(parent, key, sizeof(*a));
+	if (a == NULL)
+		return (NULL);
+	a->value = value;
+	a->agg.sum = value;
+	a->agg.min = value;
+	a->agg.max = value;
+	a->agg.count = 1;
+	return (&a->avl);
+}
+
+/**
+ * agg_insert - Stores a value under a key of an aggregate AVL tree.
+ *
+ * @tree: A double pointer to the root node of the tree.
+ * @key: The key.
+ * @value: The value to store under @key.
+ *
+ * Return: A pointer to the node holding @key, or NULL on failure.
+ *
+ * Description: A key already present gets its value replaced and the
+ * aggregates above it recomputed. A new key gets a node, and the tree
+ * is rebalanced by avl_retrace with agg_update, which also keeps the
+ * aggregates right through the rotations. Both cost O(log n).
+ */
+avl_t *agg_insert(avl_t **tree, int key, int value)
+{
+	avl_t *node, *parent = NULL;
+
+	if (tree == NULL)
+		return (NULL);
+	for (node = *tree; node != NULL && node->n != key;)
+	{
+		parent = node;
+		node = key < node->n ? node->left : node->right;
+	}
+	if (node != NULL)
+	{
+		((agg_node_t *)node)->value = value;
+		for (parent = node; parent != NULL; parent = parent->parent)
+			agg_update(parent);
+		return (node);
+	}
+	node = agg_node(parent, key, value);
+	if (node == NULL)
+		return (NULL);
+	if (parent == NULL)
+		return (*tree = node);
+	if (key < parent->n)
+		parent->left = node;
+	else
+		parent->right = node;
+	avl_retrace(tree, parent, agg_update);
+	return (node);
+}
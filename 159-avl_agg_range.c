@@ -0,0 +1,120 @@
+#include "binary_trees.h"
+#include "limits.h"
+
+/**
+ * agg_side - Aggregates one side of a range below its split node.
+ *
+ * @node: The child of the split node on that side.
+ * @bound: The range bound on that side.
+ * @upper: 0 for the left side, bounded by the lowest key, 1 for the
+ * right side, bounded by the greatest key.
+ * @acc: A pointer to the aggregate to add to.
+ *
+ * Description: Walks down towards @bound. Each node inside the range
+ * adds its own value and the aggregate of its subtree facing the split
+ * node, which lies wholly inside the range, in O(log n).
+ */
+void agg_side(const avl_t *node, int bound, int upper, agg_t *acc)
+{
+	agg_t one;
+
+	while (node != NULL)
+	{
+		if (upper ? node->n > bound : node->n < bound)
+		{
+			node = upper ? node->left : node->right;
+			continue;
+		}
+		one.sum = one.min = one.max = ((const agg_node_t *)node)->value;
+		one.count = 1;
+		agg_merge(acc, &one);
+		agg_merge(acc, agg_of(upper ? node->left : node->right));
+		node = upper ? node->right : node->left;
+	}
+}
+
+/**
+ * agg_range - Aggregates the values of the keys within a range.
+ *
+ * @tree: A pointer to the root node of the aggregate AVL tree.
+ * @lo: The lowest key of the range.
+ * @hi: The greatest key of the range.
+ * @out: Address where the aggregate is stored.
+ *
+ * Return: The number of keys in [@lo, @hi].
+ *
+ * Description: Descends to the highest node within the range, where the
+ * searches for @lo and @hi split, then follows both paths with
+ * agg_side. The keys of the range are never visited one by one, so
+ * any range costs O(log n).
+ */
+size_t agg_range(const avl_t *tree, int lo, int hi, agg_t *out)
+{
+	agg_t one;
+
+	out->sum = 0;
+	out->min = INT_MAX;
+	out->max = INT_MIN;
+	out->count = 0;
+	while (tree != NULL && (tree->n < lo || tree->n > hi))
+		tree = tree->n < lo ? tree->right : tree->left;
+	if (tree == NULL || lo > hi)
+		return (0);
+	one.sum = one.min = one.max = ((const agg_node_t *)tree)->value;
+	one.count = 1;
+	agg_merge(out, &one);
+	agg_side(tree->left, lo, 0, out);
+	agg_side(tree->right, hi, 1, out);
+	return (out->count);
+}
+
+/**
+ * agg_range_sum - Sums the values of the keys within a range.
+ *
+ * @tree: A pointer to the root node of the aggregate AVL tree.
+ * @lo: The lowest key of the range.
+ * @hi: The greatest key of the range.
+ *
+ * Return: The sum of the values, 0 for an empty range.
+ */
+long agg_range_sum(const avl_t *tree, int lo, int hi)
+{
+	agg_t agg;
+
+	agg_range(tree, lo, hi, &agg);
+	return (agg.sum);
+}
+
+/**
+ * agg_range_min - Finds the lowest value of the keys within a range.
+ *
+ * @tree: A pointer to the root node of the aggregate AVL tree.
+ * @lo: The lowest key of the range.
+ * @hi: The greatest key of the range.
+ *
+ * Return: The lowest value, INT_MAX for an empty range.
+ */
+int agg_range_min(const avl_t *tree, int lo, int hi)
+{
+	agg_t agg;
+
+	agg_range(tree, lo, hi, &agg);
+	return (agg.min);
+}
+
+/**
+ * agg_range_max - Finds the greatest value of the keys within a range.
+ *
+ * @tree: A pointer to the root node of the aggregate AVL tree.
+ * @lo: The lowest key of the range.
+ * @hi: The greatest key of the range.
+ *
+ * Return: The greatest value, INT_MIN for an empty range.
+ */
+int agg_range_max(const avl_t *tree, int lo, int hi)
+{
+	agg_t agg;
+
+	agg_range(tree, lo, hi, &agg);
+	return (agg.max);
+}
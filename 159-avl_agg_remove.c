@@ -0,0 +1,38 @@
+#include "binary_trees.h"
+
+/**
+ * agg_copy - Copies the value of an aggregate node into another one.
+ *
+ * @dst: A pointer to the node taking the key of @src.
+ * @src: A pointer to the node whose key moves, about to be removed.
+ */
+void agg_copy(avl_t *dst, const avl_t *src)
+{
+	((agg_node_t *)dst)->value = ((const agg_node_t *)src)->value;
+}
+
+/**
+ * agg_remove - Removes a key from an aggregate AVL tree.
+ *
+ * @tree: A double pointer to the root node of the tree.
+ * @key: The key to remove.
+ *
+ * Return: 1 if @key was removed, 0 if it is not present.
+ *
+ * Description: avl_unlink removes the node with agg_copy and
+ * agg_update. Every aggregate on the path loses one key, so they are
+ * all recomputed up to the root, in O(log n).
+ */
+int agg_remove(avl_t **tree, int key)
+{
+	avl_t *node;
+
+	if (tree == NULL)
+		return (0);
+	for (node = *tree; node != NULL && node->n != key;)
+		node = key < node->n ? node->left : node->right;
+	if (node == NULL)
+		return (0);
+	avl_unlink(tree, node, agg_copy, agg_update);
+	return (1);
+}
@@ -0,0 +1,37 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    avl_t *tree = NULL;
+    int samples[][2] = {
+        {100, 7}, {110, 3}, {120, 12}, {130, -4}, {140, 9},
+        {150, 1}, {160, 15}, {170, 6}, {180, 2}, {190, 8}
+    };
+    agg_t agg;
+    size_t i;
+
+    for (i = 0; i < sizeof(samples) / sizeof(samples[0]); i++)
+        agg_insert(&tree, samples[i][0], samples[i][1]);
+    binary_tree_print(tree);
+    agg_range(tree, 115, 175, &agg);
+    printf("[115, 175]: %lu keys, sum %ld, min %d, max %d\n",
+           (unsigned long)agg.count, agg.sum, agg.min, agg.max);
+
+    agg_insert(&tree, 130, 20);
+    agg_remove(&tree, 160);
+    printf("130 set to 20, 160 removed\n");
+    binary_tree_print(tree);
+    printf("[115, 175]: sum %ld, min %d, max %d\n",
+           agg_range_sum(tree, 115, 175), agg_range_min(tree, 115, 175),
+           agg_range_max(tree, 115, 175));
+    printf("[0, 99]: sum %ld\n", agg_range_sum(tree, 0, 99));
+    binary_tree_delete(tree);
+    return (0);
+}
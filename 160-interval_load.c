@@ -0,0 +1,75 @@
+#include "binary_trees.h"
+
+/**
+ * interval_build - Builds an interval subtree from sorted intervals.
+ *
+ * @starts: The sorted starts of the intervals.
+ * @ends: The ends of the intervals.
+ * @size: The number of intervals.
+ * @parent: A pointer to the parent of the subtree.
+ * @link: Address where the subtree root is stored.
+ *
+ * Return: 1 on success, 0 on allocation failure.
+ *
+ * Description: Picks the same middle element as sorted_array_to_avl,
+ * builds both halves, then sets the height and greatest end of the node.
+ */
+int interval_build(const int *starts, const int *ends, size_t size,
+		avl_t *parent, avl_t **link)
+{
+	size_t mid;
+	avl_t *node;
+
+	*link = NULL;
+	if (size == 0)
+		return (1);
+	mid = (size - 1) / 2;
+	node = interval_node(parent, starts[mid], ends[mid]);
+	if (node == NULL)
+		return (0);
+	*link = node;
+	if (!interval_build(starts, ends, mid, node, &node->left) ||
+			!interval_build(starts + mid + 1, ends + mid + 1,
+				size - mid - 1, node, &node->right))
+		return (0);
+	interval_update(node);
+	return (1);
+}
+
+/**
+ * interval_load - Builds an interval tree from sorted intervals.
+ *
+ * @starts: The starts of the intervals.
+ * @ends: The ends of the intervals, @ends[i] going with @starts[i].
+ * @size: The number of intervals.
+ *
+ * Return: A pointer to the root node of the interval tree, or NULL on
+ *         failure or if the intervals are not sorted.
+ *
+ * Description: The intervals must be sorted by start then end, without
+ * duplicates, and each end must not be lower than its start. The tree
+ * is built in O(n) without any rotation, and can then be updated with
+ * interval_insert and interval_remove.
+ */
+avl_t *interval_load(const int *starts, const int *ends, size_t size)
+{
+	avl_t *root;
+	size_t i;
+	int sorted;
+
+	if (starts == NULL || ends == NULL || size == 0)
+		return (NULL);
+	for (i = 0; i < size; i++)
+	{
+		sorted = i == 0 || starts[i - 1] < starts[i] ||
+			(starts[i - 1] == starts[i] && ends[i - 1] < ends[i]);
+		if (!sorted || ends[i] < starts[i])
+			return (NULL);
+	}
+	if (!interval_build(starts, ends, size, NULL, &root))
+	{
+		binary_tree_delete(root);
+		return (NULL);
+	}
+	return (root);
+}
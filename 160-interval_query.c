@@ -0,0 +1,79 @@
+#include "binary_trees.h"
+
+/**
+ * interval_visit - Collects the intervals of a subtree overlapping a
+ * range.
+ *
+ * @node: A pointer to the root node of the subtree.
+ * @lo: The lowest point of the range.
+ * @hi: The greatest point of the range.
+ * @out: Array receiving the overlapping nodes.
+ * @size: The number of nodes @out can hold.
+ * @found: A pointer to the number of overlapping nodes found so far.
+ *
+ * Description: A subtree whose greatest end is lower than @lo holds no
+ * overlapping interval, and neither do the right subtrees of the nodes
+ * starting after @hi, so both are skipped.
+ */
+void interval_visit(const avl_t *node, int lo, int hi, const avl_t **out,
+		size_t size, size_t *found)
+{
+	while (node != NULL && ((const interval_node_t *)node)->max_end >= lo)
+	{
+		interval_visit(node->left, lo, hi, out, size, found);
+		if (node->n > hi)
+			return;
+		if (((const interval_node_t *)node)->end >= lo)
+		{
+			if (*found < size)
+				out[*found] = node;
+			(*found)++;
+		}
+		node = node->right;
+	}
+}
+
+/**
+ * interval_overlap - Finds the intervals overlapping a range.
+ *
+ * @tree: A pointer to the root node of the interval tree.
+ * @lo: The lowest point of the range.
+ * @hi: The greatest point of the range.
+ * @out: Array receiving the overlapping nodes, in order, may be NULL
+ * if @size is 0.
+ * @size: The number of nodes @out can hold.
+ *
+ * Return: The number of intervals overlapping [@lo, @hi], of which the
+ *         first @size are stored in @out.
+ *
+ * Description: Intervals and the range are closed. The walk visits the
+ * k reported nodes plus the search paths leading to them, which costs
+ * O(log n + k) when they are clustered and O(k log n) at worst.
+ */
+size_t interval_overlap(const avl_t *tree, int lo, int hi,
+		const avl_t **out, size_t size)
+{
+	size_t found = 0;
+
+	if (lo <= hi)
+		interval_visit(tree, lo, hi, out, size, &found);
+	return (found);
+}
+
+/**
+ * interval_stab - Finds the intervals containing a point.
+ *
+ * @tree: A pointer to the root node of the interval tree.
+ * @point: The point.
+ * @out: Array receiving the containing nodes, in order, may be NULL if
+ * @size is 0.
+ * @size: The number of nodes @out can hold.
+ *
+ * Return: The number of intervals containing @point, of which the
+ *         first @size are stored in @out.
+ */
+size_t interval_stab(const avl_t *tree, int point, const avl_t **out,
+		size_t size)
+{
+	return (interval_overlap(tree, point, point, out, size));
+}
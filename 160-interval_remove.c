@@ -0,0 +1,44 @@
+#include "binary_trees.h"
+
+/**
+ * interval_copy - Copies the end of an interval node into another one.
+ *
+ * @dst: A pointer to the node taking the start of @src.
+ * @src: A pointer to the node whose start moves, about to be removed.
+ */
+void interval_copy(avl_t *dst, const avl_t *src)
+{
+	((interval_node_t *)dst)->end = ((const interval_node_t *)src)->end;
+}
+
+/**
+ * interval_remove - Removes an interval from an interval tree.
+ *
+ * @tree: A double pointer to the root node of the interval tree.
+ * @start: The start of the interval.
+ * @end: The end of the interval.
+ *
+ * Return: 1 if the interval was removed, 0 if it is not in the tree.
+ *
+ * Description: avl_unlink removes the node with interval_copy and
+ * interval_update, which keeps the greatest ends right, in O(log n).
+ */
+int interval_remove(avl_t **tree, int start, int end)
+{
+	avl_t *node;
+	int cmp;
+
+	if (tree == NULL)
+		return (0);
+	for (node = *tree; node != NULL; )
+	{
+		cmp = interval_cmp(node, start, end);
+		if (cmp == 0)
+			break;
+		node = cmp < 0 ? node->left : node->right;
+	}
+	if (node == NULL)
+		return (0);
+	avl_unlink(tree, node, interval_copy, interval_update);
+	return (1);
+}
@@ -0,0 +1,110 @@
+#include "binary_trees.h"
+
+/**
+ * interval_cmp - Compares an interval with the interval of a node.
+ *
+ * @node: A pointer to the interval tree node.
+ * @start: The start of the interval.
+ * @end: The end of the interval.
+ *
+ * Return: A negative value if [@start, @end] sorts before the interval
+ *         of @node, positive if it sorts after, 0 if they are equal.
+ *         Intervals sort by start, then by end.
+ */
+int interval_cmp(const avl_t *node, int start, int end)
+{
+	int node_end = ((const interval_node_t *)node)->end;
+
+	if (start != node->n)
+		return (start < node->n ? -1 : 1);
+	if (end != node_end)
+		return (end < node_end ? -1 : 1);
+	return (0);
+}
+
+/**
+ * interval_update - Recomputes the height and greatest end of a node.
+ *
+ * @node: A pointer to the node, whose children are up to date.
+ *
+ * Return: 1 if the height or the greatest end changed, 0 otherwise.
+ */
+int interval_update(avl_t *node)
+{
+	interval_node_t *i = (interval_node_t *)node;
+	int old = i->max_end, changed = avl_update_height(node), end;
+
+	i->max_end = i->end;
+	if (node->left != NULL)
+	{
+		end = ((interval_node_t *)node->left)->max_end;
+		if (end > i->max_end)
+			i->max_end = end;
+	}
+	if (node->right != NULL)
+	{
+		end = ((interval_node_t *)node->right)->max_end;
+		if (end > i->max_end)
+			i->max_end = end;
+	}
+	return (changed || i->max_end != old);
+}
+
+/**
+ * interval_node - Creates an interval tree node.
+ *
+ * @parent: A pointer to the parent node.
+ * @start: The start of the interval.
+ * @end: The end of the interval.
+ *
+ * Return: A pointer to the AVL node embedded in the new node, or NULL
+ *         on failure.
+ */
+avl_t *interval_node(avl_t *parent, int start, int end)
+{
+	interval_node_t *i;
+
+	i = (interval_node_t *)binary_tree_node_size(parent, start, sizeof(*i));
+	if (i == NULL)
+		return (NULL);
+	i->end = end;
+	i->max_end = end;
+	return (&i->avl);
+}
+
+/**
+ * interval_insert - Inserts an interval into an interval tree.
+ *
+ * @tree: A double pointer to the root node of the interval tree.
+ * @start: The start of the interval.
+ * @end: The end of the interval, not lower than @start.
+ *
+ * Return: A pointer to the new node, or NULL on failure, if @end is
+ *         lower than @start or if the interval is already in the tree.
+ *
+ * Description: The tree is rebalanced by avl_retrace with
+ * interval_update, which keeps the greatest ends right through the
+ * rotations, in O(log n).
+ */
+avl_t *interval_insert(avl_t **tree, int start, int end)
+{
+	avl_t *node, *parent = NULL, **link;
+	int cmp;
+
+	if (tree == NULL || end < start)
+		return (NULL);
+	for (link = tree; *link != NULL;)
+	{
+		parent = *link;
+		cmp = interval_cmp(parent, start, end);
+		if (cmp == 0)
+			return (NULL);
+		link = cmp < 0 ? &parent->left : &parent->right;
+	}
+	node = interval_node(parent, start, end);
+	if (node == NULL)
+		return (NULL);
+	*link = node;
+	avl_retrace(tree, parent, interval_update);
+	return (node);
+}
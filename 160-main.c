@@ -0,0 +1,55 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_intervals - Prints the intervals of an array of nodes
+ *
+ * @nodes: The interval tree nodes
+ * @count: The number of nodes
+ */
+void print_intervals(const avl_t **nodes, size_t count)
+{
+    size_t i;
+
+    for (i = 0; i < count; i++)
+        printf(" [%d, %d]", nodes[i]->n,
+               ((const interval_node_t *)nodes[i])->end);
+    printf("\n");
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    int starts[] = {5, 10, 12, 15, 17, 19, 21, 25, 30};
+    int ends[] = {20, 30, 15, 23, 19, 20, 24, 30, 40};
+    const avl_t *out[9];
+    avl_t *tree;
+    size_t n;
+
+    tree = interval_load(starts, ends, 9);
+    if (!tree)
+        return (1);
+    binary_tree_print(tree);
+    n = interval_stab(tree, 18, out, 9);
+    printf("%lu intervals contain 18:", (unsigned long)n);
+    print_intervals(out, n);
+    n = interval_overlap(tree, 24, 26, out, 9);
+    printf("%lu intervals overlap [24, 26]:", (unsigned long)n);
+    print_intervals(out, n);
+
+    interval_remove(&tree, 10, 30);
+    interval_insert(&tree, 1, 2);
+    interval_insert(&tree, 3, 4);
+    printf("Removed [10, 30], inserted [1, 2] and [3, 4]\n");
+    binary_tree_print(tree);
+    n = interval_overlap(tree, 24, 26, out, 9);
+    printf("%lu intervals overlap [24, 26]:", (unsigned long)n);
+    print_intervals(out, n);
+    binary_tree_delete(tree);
+    return (0);
+}
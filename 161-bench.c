@@ -0,0 +1,96 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/*
+ * gcc -O2 161-bench.c 161-heap_handle.c 131-heap_insert.c
+ *     132-array_to_heap.c 133-heap_extract.c 134-heap_to_sorted_array.c
+ *     3-binary_tree_delete.c 0-binary_tree_node.c -o 161-bench
+ *
+ * ./161-bench [max_exponent], sizes 10^5 up to 10^max_exponent (default 7)
+ */
+
+/**
+ * seconds - Reads a monotonic clock
+ *
+ * Return: The current time in seconds
+ */
+double seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec + now.tv_nsec / 1e9);
+}
+
+/**
+ * bench_size - Times building a heap of n random values both ways,
+ * then sorting it with heap_to_sorted_array
+ *
+ * @values: Array of at least n random values
+ * @n: Number of values
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int bench_size(int *values, size_t n)
+{
+    heap_t *heap = NULL;
+    size_t i, size;
+    double start, loop, bulk, sort;
+    int *sorted;
+
+    start = seconds();
+    for (i = 0; i < n; i++)
+        if (!heap_insert(&heap, values[i]))
+            return (1);
+    loop = seconds() - start;
+    binary_tree_delete(heap);
+    start = seconds();
+    heap = array_to_heap(values, n);
+    bulk = seconds() - start;
+    if (!heap)
+        return (1);
+    start = seconds();
+    sorted = heap_to_sorted_array(heap, &size);
+    sort = seconds() - start;
+    if (!sorted)
+        return (1);
+    free(sorted);
+    printf("%9lu values, heap_insert loop %7.3fs, array_to_heap %7.3fs,"
+           " heap_to_sorted_array %7.3fs\n", (unsigned long)n, loop, bulk,
+           sort);
+    return (0);
+}
+
+/**
+ * main - Benchmarks heap building with heap_insert and array_to_heap,
+ * and heap sorting with heap_to_sorted_array
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments, the optional largest power of ten to measure
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int argc, char **argv)
+{
+    int max = argc > 1 ? atoi(argv[1]) : 7, e, *values;
+    size_t i, n = 10000, top = 1;
+
+    for (e = 0; e < max; e++)
+        top *= 10;
+    values = malloc(sizeof(*values) * top);
+    if (!values)
+        return (1);
+    srand(49);
+    for (i = 0; i < top; i++)
+        values[i] = rand();
+    for (e = 5; e <= max; e++)
+    {
+        n *= 10;
+        if (bench_size(values, n))
+            break;
+    }
+    free(values);
+    return (0);
+}
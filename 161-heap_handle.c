@@ -0,0 +1,119 @@
+#include "binary_trees.h"
+
+/**
+ * heap_node_at - Finds a node of a heap by its level order index.
+ *
+ * @root: A pointer to the root node of the heap.
+ * @index: The 1-based level order index of the node; the root is 1.
+ *
+ * Return: A pointer to the node, or NULL if it does not exist.
+ *
+ * Description: Below the leading one, each bit of @index picks the left
+ * (0) or right (1) child, from the root down, in O(log n).
+ */
+heap_t *heap_node_at(heap_t *root, size_t index)
+{
+	size_t bit = 1;
+
+	if (index == 0)
+		return (NULL);
+	while (bit <= index / 2)
+		bit <<= 1;
+	for (bit >>= 1; root != NULL && bit != 0; bit >>= 1)
+		root = index & bit ? root->right : root->left;
+	return (root);
+}
+
+/**
+ * heap_size - Counts the nodes of a heap.
+ *
+ * @root: A pointer to the root node of the heap.
+ *
+ * Return: The number of nodes of the heap, 0 if @root is NULL.
+ *
+ * Description: A heap is a complete tree. When both subtrees of a node
+ * have the same leftmost depth, its left subtree is perfect and only
+ * the right one needs counting, and otherwise the right subtree is
+ * perfect. This counts in O(log^2 n) without visiting every node.
+ */
+size_t heap_size(const heap_t *root)
+{
+	size_t count = 0, left, right;
+	const heap_t *node;
+
+	while (root != NULL)
+	{
+		left = right = 0;
+		for (node = root->left; node != NULL; node = node->left)
+			left++;
+		for (node = root->right; node != NULL; node = node->left)
+			right++;
+		if (left == right)
+		{
+			count += (size_t)1 << left;
+			root = root->right;
+		}
+		else
+		{
+			count += (size_t)1 << right;
+			root = root->left;
+		}
+	}
+	return (count);
+}
+
+/**
+ * heap_handle_init - Wraps an existing heap into a handle.
+ *
+ * @heap: A pointer to the handle to set.
+ * @root: A pointer to the root node of the heap, may be NULL.
+ */
+void heap_handle_init(heap_handle_t *heap, heap_t *root)
+{
+	heap->root = root;
+	heap->size = heap_size(root);
+}
+
+/**
+ * heap_handle_insert - Inserts a value into a Max Binary Heap.
+ *
+ * @heap: A pointer to the heap handle.
+ * @value: The value to be inserted into the heap.
+ *
+ * Return: A pointer to the node holding @value once the heap property
+ *         is restored, or NULL on failure.
+ *
+ * Description: The new node goes to level order index size + 1, below
+ * the node at index (size + 1) / 2 found by heap_node_at. The value is
+ * then swapped with its parent's while it is greater. Both walks cost
+ * O(log n), and the handle keeps the count up to date.
+ */
+heap_t *heap_handle_insert(heap_handle_t *heap, int value)
+{
+	heap_t *parent, *node;
+	size_t index;
+	int tmp;
+
+	if (heap == NULL)
+		return (NULL);
+	index = heap->size + 1;
+	parent = heap_node_at(heap->root, index / 2);
+	node = binary_tree_node(parent, value);
+	if (node == NULL)
+		return (NULL);
+	if (parent == NULL)
+		heap->root = node;
+	else if (index & 1)
+		parent->right = node;
+	else
+		parent->left = node;
+	heap->size++;
+	while (node->parent != NULL && node->n > node->parent->n)
+	{
+		tmp = node->n;
+		node->n = node->parent->n;
+		node->parent->n = tmp;
+		node = node->parent;
+	}
+	return (node);
+}
@@ -10,6 +10,9 @@
 /**
  * struct binary_tree_s - Binary tree node
  * @n: Integer stored in the node
+ * @meta: Balancing data owned by the tree family using the node (treap
+ * priority, red-black color, AVL height...), 0 for plain trees. It fills
+ * the padding after @n, so the node keeps its size.
  * @parent: Pointer to the parent node
  * @left: Pointer to the left child node
  * @right: Pointer to the right child node
@@ -17,6 +20,7 @@
 struct binary_tree_s
 {
 	int n;
+	int meta;
 	struct binary_tree_s *parent;
 	struct binary_tree_s *left;
 	struct binary_tree_s *right;
@@ -26,6 +30,40 @@ typedef struct binary_tree_s bst_t;
 typedef struct binary_tree_s avl_t;
 typedef struct binary_tree_s heap_t;
 
+/* Red-black node colors, kept in the meta field */
+#define RB_RED 0
+#define RB_BLACK 1
+
+/* Prefetch hint for the search kernels, a no-op without GCC */
+#ifdef __GNUC__
+#define TREE_PREFETCH(p) __builtin_prefetch(p)
+#else
+#define TREE_PREFETCH(p) ((void)(p))
+#endif
+
+/* Searches kept in flight by bst_walk_many, and what each one answers */
+#define SEARCH_MANY_GROUP 16
+#define SEARCH_EXACT 0
+#define SEARCH_FLOOR 1
+#define SEARCH_CEILING 2
+
+/* S-tree keys per 64-byte block, and searches run side by side */
+#define STREE_B 16
+#define STREE_GROUP 16
+
+/* Weight-balanced tree parameters and set operations */
+#define WBT_DELTA 3
+#define WBT_RATIO 2
+#define WBT_GRAIN 65536
+#define WBT_SPLITS 3
+#define WBT_UNION 0
+#define WBT_INTERSECTION 1
+#define WBT_DIFFERENCE 2
+
+/* Contiguous AVL build: smallest subtree handed to a thread, fork depth */
+#define AVL_BLOCK_GRAIN 65536
+#define AVL_BLOCK_SPLITS 3
+
 /**
  * struct levelorder_queue_s - Level order traversal queue.
  * @node: A node of a binary tree.
@@ -46,6 +84,257 @@ typedef struct node_s
         const binary_tree_t *node;
         struct node_s *next;
 } ll;
+
+/**
+ * struct lca_slot_s - Node to Euler tour position hash slot
+ * @node: Node stored in the slot, NULL if the slot is free
+ * @first: Position of @node in the arrays of the owning index (its first
+ * Euler tour entry for lca_index_t)
+ */
+typedef struct lca_slot_s
+{
+	const binary_tree_t *node;
+	size_t first;
+} lca_slot_t;
+
+/**
+ * struct lca_index_s - Euler tour / sparse table LCA index
+ * @euler: Nodes of the Euler tour (2n - 1 entries)
+ * @depth: Depth of each Euler tour entry
+ * @tour_size: Number of entries in the Euler tour
+ * @sparse: @levels rows of @tour_size range-minimum positions
+ * @levels: Number of rows in @sparse
+ * @log2: Floor of log2 for every range length up to @tour_size
+ * @slots: Open addressing table mapping nodes to their first position
+ * @mask: Number of slots minus one
+ */
+typedef struct lca_index_s
+{
+	const binary_tree_t **euler;
+	size_t *depth;
+	size_t tour_size;
+	size_t *sparse;
+	size_t levels;
+	unsigned char *log2;
+	lca_slot_t *slots;
+	size_t mask;
+} lca_index_t;
+
+/**
+ * struct lift_table_s - Binary lifting jump table
+ * @nodes: Indexed nodes in preorder, parents before children
+ * @depth: Depth of each node below the indexed root
+ * @up: One row of @levels positions per node; entry k of a row is the
+ * position of the node's 2^k-th ancestor
+ * @size: Number of indexed nodes
+ * @capacity: Number of nodes the arrays can hold
+ * @levels: Number of jumps per row, with 2^@levels above every depth
+ * @slots: Open addressing table mapping nodes to their position
+ * @mask: Number of slots minus one
+ */
+typedef struct lift_table_s
+{
+	const binary_tree_t **nodes;
+	size_t *depth;
+	unsigned int *up;
+	size_t size;
+	size_t capacity;
+	size_t levels;
+	lca_slot_t *slots;
+	size_t mask;
+} lift_table_t;
+
+/**
+ * struct lca_query_s - Pair of nodes for a batched ancestor query
+ * @first: Pointer to the first node
+ * @second: Pointer to the second node
+ */
+typedef struct lca_query_s
+{
+	const binary_tree_t *first;
+	const binary_tree_t *second;
+} lca_query_t;
+
+/**
+ * struct lca_batch_s - Work arrays of an offline batched ancestor pass
+ * @map: Preorder numbering of the tree and its node to position slots
+ * @up: Position of the parent of each node
+ * @set: Union-find parent of each node
+ * @anc: Ancestor tag of each union-find representative
+ * @rank: Union-find rank of each node
+ * @done: Whether each node has been finished
+ * @head: Start of each node's bucket in @bucket (one extra end entry)
+ * @ends: Position of each query endpoint, (size_t)-1 if not in the tree
+ * @bucket: Endpoints grouped by the node facing them
+ */
+typedef struct lca_batch_s
+{
+	lift_table_t map;
+	size_t *up;
+	size_t *set;
+	size_t *anc;
+	unsigned char *rank;
+	unsigned char *done;
+	size_t *head;
+	size_t *ends;
+	size_t *bucket;
+} lca_batch_t;
+
+/**
+ * struct scapegoat_s - Scapegoat tree
+ * @root: Pointer to the root node of the underlying BST
+ * @size: Number of nodes in the tree
+ * @max_size: Largest @size since the last full rebuild
+ * @alpha: Balance factor, strictly between 0.5 and 1
+ */
+typedef struct scapegoat_s
+{
+	bst_t *root;
+	size_t size;
+	size_t max_size;
+	double alpha;
+} scapegoat_t;
+
+/**
+ * struct bst_frozen_s - Read-only Eytzinger search index over a BST
+ * @keys: Keys in Eytzinger order from position 1, position k having its
+ * children at 2k and 2k + 1; aligned on a 64-byte cache line
+ * @nodes: BST node holding the key at each position
+ * @size: Number of keys
+ * @block: Allocation holding @keys
+ */
+typedef struct bst_frozen_s
+{
+	int *keys;
+	const bst_t **nodes;
+	size_t size;
+	void *block;
+} bst_frozen_t;
+
+/**
+ * struct stree_s - Static (STREE_B + 1)-ary search tree over a BST
+ * @keys: Blocks of STREE_B sorted keys, aligned on 64-byte cache lines;
+ * block k has its children at k * (STREE_B + 1) + 1 onwards and the
+ * slots past the last key hold INT_MAX
+ * @nodes: BST node holding the key of each slot, NULL for padding
+ * @size: Number of keys
+ * @blocks: Number of blocks
+ * @block: Allocation holding @keys
+ */
+typedef struct stree_s
+{
+	int *keys;
+	const bst_t **nodes;
+	size_t size;
+	size_t blocks;
+	void *block;
+} stree_t;
+
+/**
+ * struct mset_node_s - AVL multiset node
+ * @avl: Underlying AVL node, first so that the multiset node can be
+ * handled, printed and freed as an avl_t; @avl.meta holds its height
+ * @count: Occurrences of the key @avl.n
+ * @total: Occurrences of every key of the subtree
+ */
+typedef struct mset_node_s
+{
+	avl_t avl;
+	size_t count;
+	size_t total;
+} mset_node_t;
+
+/**
+ * struct agg_s - Aggregate of the values of a set of keys
+ * @sum: Sum of the values
+ * @min: Lowest value, INT_MAX for an empty set
+ * @max: Greatest value, INT_MIN for an empty set
+ * @count: Number of keys
+ */
+typedef struct agg_s
+{
+	long sum;
+	int min;
+	int max;
+	size_t count;
+} agg_t;
+
+/**
+ * struct agg_node_s - Aggregate-augmented AVL node
+ * @avl: Underlying AVL node, first so that the node can be handled,
+ * printed and freed as an avl_t; @avl.n is the key, @avl.meta its height
+ * @value: Value stored under the key
+ * @agg: Aggregate of the values of the whole subtree
+ */
+typedef struct agg_node_s
+{
+	avl_t avl;
+	int value;
+	agg_t agg;
+} agg_node_t;
+
+/**
+ * struct interval_node_s - Interval tree node, for the interval
+ * [@avl.n, @end]
+ * @avl: Underlying AVL node, first so that the node can be handled,
+ * printed and freed as an avl_t; @avl.n is the start of the interval,
+ * @avl.meta its height
+ * @end: End of the interval, included
+ * @max_end: Greatest end of the whole subtree
+ */
+typedef struct interval_node_s
+{
+	avl_t avl;
+	int end;
+	int max_end;
+} interval_node_t;
+
+/**
+ * struct heap_handle_s - Max binary heap with its node count
+ * @root: Pointer to the root node of the heap
+ * @size: Number of nodes in the heap, whose bits give the path to the
+ * last node and to the next free slot
+ */
+typedef struct heap_handle_s
+{
+	heap_t *root;
+	size_t size;
+} heap_handle_t;
+
+/**
+ * struct wbt_task_s - One half of a weight-balanced tree set operation
+ * @a: Root node of the first operand
+ * @b: Root node of the second operand
+ * @op: WBT_UNION, WBT_INTERSECTION or WBT_DIFFERENCE
+ * @splits: Recursion levels that may still fork a thread
+ * @result: Root node of the combined tree, set once the task has run
+ */
+typedef struct wbt_task_s
+{
+	bst_t *a;
+	bst_t *b;
+	int op;
+	int splits;
+	bst_t *result;
+} wbt_task_t;
+
+/**
+ * struct avl_block_task_s - One subtree of a contiguous AVL build
+ * @array: Sorted values of the subtree
+ * @size: Number of values, and of nodes in the subtree
+ * @parent: Parent node of the subtree root, NULL for the whole tree
+ * @block: First of the @size nodes, which the subtree fills in preorder
+ * @splits: Levels below which no more threads may be started
+ */
+typedef struct avl_block_task_s
+{
+	const int *array;
+	size_t size;
+	avl_t *parent;
+	avl_t *block;
+	int splits;
+} avl_block_task_t;
+
 /* Printing helper function */
 void binary_tree_print(const binary_tree_t *);
 
@@ -60,6 +349,8 @@ void binary_tree_print(const binary_tree_t *);
  * Return: Pointer to the newly created node, or NULL on failure.
  */
 binary_tree_t *binary_tree_node(binary_tree_t *parent, int value);
+binary_tree_t *binary_tree_node_size(binary_tree_t *parent, int value,
+		size_t node_size);
 
 /**
  * binary_tree_insert_left - Inserts a left child node.
@@ -226,22 +517,231 @@ binary_tree_t *binary_trees_ancestor(const binary_tree_t *first,
 		const binary_tree_t *second);
 void binary_tree_levelorder(const binary_tree_t *tree, void (*func)(int));
 int binary_tree_is_complete(const binary_tree_t *tree);
+int is_complete_index(const binary_tree_t *tree, size_t index, size_t size);
 binary_tree_t *binary_tree_rotate_left(binary_tree_t *tree);
 binary_tree_t *binary_tree_rotate_right(binary_tree_t *tree);
 int binary_tree_is_bst(const binary_tree_t *tree);
 bst_t *bst_insert(bst_t **tree, int value);
 bst_t *array_to_bst(int *array, size_t size);
+bst_t *array_to_bst_bulk(int *array, size_t size);
 bst_t *bst_search(const bst_t *tree, int value);
+bst_t *bst_min(const bst_t *tree);
+bst_t *bst_max(const bst_t *tree);
+bst_t *bst_successor(const bst_t *node);
+bst_t *bst_predecessor(const bst_t *node);
+bst_t *bst_floor(const bst_t *tree, int value);
+bst_t *bst_ceiling(const bst_t *tree, int value);
+void bst_floor_many(const bst_t *tree, const int *values, size_t count,
+		bst_t **out);
+void bst_ceiling_many(const bst_t *tree, const int *values, size_t count,
+		bst_t **out);
+bst_t *bst_finger_search(bst_t *finger, int value);
+bst_t *bst_finger_insert(bst_t **tree, bst_t *finger, int value);
+bst_t *bst_finger_climb(bst_t *finger, int value);
+bst_t *bst_finger_locate(bst_t *node, int value, bst_t **parent);
+size_t bst_search_many(const bst_t *tree, const int *keys, size_t count,
+		bst_t **out);
+size_t bst_walk_many(const bst_t *tree, const int *keys, size_t count,
+		bst_t **out, int mode);
 bst_t *bst_remove(bst_t *root, int value);
+bst_t *bst_bulk_load(const int *array, size_t size, int contiguous);
+void bst_bulk_delete(bst_t *root);
+int *bulk_sort_unique(const int *array, size_t size, size_t *count);
+int *bulk_unique_order(const int *array, size_t size, size_t *count);
+int bulk_radix_pass(const unsigned int *src, unsigned int *dst, size_t size,
+		int shift);
+int bulk_build(const int *array, size_t size, bst_t *parent, bst_t **link,
+		bst_t **pool);
+bst_frozen_t *bst_freeze(const bst_t *root);
+bst_t *bst_frozen_search(const bst_frozen_t *index, int value);
+void bst_frozen_delete(bst_frozen_t *index);
+void freeze_fill(bst_frozen_t *index, size_t k, const bst_t **node);
+stree_t *stree_create(const bst_t *root);
+void stree_delete(stree_t *tree);
+void stree_fill(stree_t *tree, size_t k, const bst_t **node);
+bst_t *stree_search(const stree_t *tree, int value);
+bst_t *stree_lower_bound(const stree_t *tree, int value);
+bst_t *stree_upper_bound(const stree_t *tree, int value);
+size_t stree_search_batch(const stree_t *tree, const int *values,
+		size_t count, bst_t **out);
+void stree_batch_group(const stree_t *tree, const int *values, size_t count,
+		bst_t **out);
+size_t stree_bound(const stree_t *tree, int value);
+size_t stree_rank(const int *keys, int value);
+bst_t *bst_remove_range(bst_t *root, int lo, int hi);
+bst_t *tree_remove_if(bst_t *root, int (*pred)(int, void *), void *ctx);
+void bst_cut(bst_t *root, int key, bst_t **lo, bst_t **hi);
+void bst_delete_flat(bst_t *tree);
+bst_t *bst_rebalance(bst_t *root);
+bst_t *bst_rebalance_auto(bst_t *root, double factor);
+bst_t *bst_tree_to_vine(bst_t *root, size_t *size);
+bst_t *bst_vine_compress(bst_t *head, size_t count);
+size_t bst_measure(const bst_t *root, size_t *size);
+bst_t *splay(bst_t *node);
+bst_t *splay_search(bst_t **tree, int value);
+bst_t *splay_insert(bst_t **tree, int value);
+bst_t *splay_remove(bst_t *root, int value);
+bst_t *treap_insert(bst_t **tree, int value);
+bst_t *treap_remove(bst_t *root, int value);
+void treap_split(bst_t *root, int key, bst_t **lo, bst_t **hi);
+bst_t *treap_merge(bst_t *lo, bst_t *hi);
+bst_t *rb_insert(bst_t **tree, int value);
+bst_t *rb_remove(bst_t *root, int value);
+bst_t *rb_search(const bst_t *tree, int value);
+int binary_tree_is_rb(const binary_tree_t *tree);
+bst_t *rb_rotate(bst_t *root, bst_t *node, int left);
+bst_t *rb_insert_fixup(bst_t *root, bst_t *node);
+bst_t *rb_remove_fixup(bst_t *root, bst_t *node, bst_t *parent);
+int rb_is_black(const bst_t *node);
+int rb_black_height(const binary_tree_t *tree, long lo, long hi);
+scapegoat_t *scapegoat_create(double alpha);
+int scapegoat_set_alpha(scapegoat_t *tree, double alpha);
+void scapegoat_delete(scapegoat_t *tree);
+bst_t *scapegoat_insert(scapegoat_t *tree, int value);
+int scapegoat_remove(scapegoat_t *tree, int value);
+size_t scapegoat_depth_limit(size_t size, double alpha);
+bst_t *scapegoat_find(bst_t *node, double alpha);
+void scapegoat_flatten(const bst_t *tree, int *array, size_t *i);
+int scapegoat_rebuild(scapegoat_t *tree, bst_t *node);
+bst_t *wbt_insert(bst_t **tree, int value);
+bst_t *wbt_remove(bst_t *root, int value);
+bst_t *wbt_union(bst_t *a, bst_t *b);
+bst_t *wbt_intersection(bst_t *a, bst_t *b);
+bst_t *wbt_difference(bst_t *a, bst_t *b);
+bst_t *wbt_join(bst_t *left, bst_t *mid, bst_t *right);
+bst_t *wbt_join2(bst_t *left, bst_t *right);
+bst_t *wbt_split(bst_t *tree, int key, bst_t **lo, bst_t **hi);
+bst_t *wbt_split_last(bst_t *tree, bst_t **last);
+bst_t *wbt_set_op(bst_t *a, bst_t *b, int op, int splits);
+void wbt_set_pair(wbt_task_t *task, int splits);
+void *wbt_set_task(void *arg);
+size_t wbt_size(const bst_t *tree);
+bst_t *wbt_node(bst_t *node, bst_t *left, bst_t *right);
+bst_t *wbt_rotate(bst_t *tree, int left);
+bst_t *wbt_balance(bst_t *tree);
+int binary_tree_is_wbt(const binary_tree_t *tree);
+long wbt_check(const binary_tree_t *tree, long lo, long hi);
 int binary_tree_is_avl(const binary_tree_t *tree);
 avl_t *avl_insert(avl_t **tree, int value);
+avl_t *mset_insert(avl_t **tree, int value);
+int mset_remove(avl_t **tree, int value);
+size_t mset_count(const avl_t *tree, int value);
+size_t mset_rank(const avl_t *tree, int value);
+size_t mset_range_count(const avl_t *tree, int lo, int hi);
+avl_t *mset_select(const avl_t *tree, size_t rank);
+size_t mset_total(const avl_t *node);
+size_t mset_below(const avl_t *tree, int value, int inclusive);
+int mset_update(avl_t *node);
+avl_t *mset_node(avl_t *parent, int value);
+void mset_copy(avl_t *dst, const avl_t *src);
+avl_t *agg_insert(avl_t **tree, int key, int value);
+int agg_remove(avl_t **tree, int key);
+size_t agg_range(const avl_t *tree, int lo, int hi, agg_t *out);
+long agg_range_sum(const avl_t *tree, int lo, int hi);
+int agg_range_min(const avl_t *tree, int lo, int hi);
+int agg_range_max(const avl_t *tree, int lo, int hi);
+const agg_t *agg_of(const avl_t *node);
+void agg_merge(agg_t *acc, const agg_t *add);
+int agg_update(avl_t *node);
+avl_t *agg_node(avl_t *parent, int key, int value);
+void agg_copy(avl_t *dst, const avl_t *src);
+void agg_side(const avl_t *node, int bound, int upper, agg_t *acc);
+avl_t *interval_insert(avl_t **tree, int start, int end);
+int interval_remove(avl_t **tree, int start, int end);
+size_t interval_overlap(const avl_t *tree, int lo, int hi,
+		const avl_t **out, size_t size);
+size_t interval_stab(const avl_t *tree, int point, const avl_t **out,
+		size_t size);
+avl_t *interval_load(const int *starts, const int *ends, size_t size);
+int interval_cmp(const avl_t *node, int start, int end);
+int interval_update(avl_t *node);
+avl_t *interval_node(avl_t *parent, int start, int end);
+void interval_copy(avl_t *dst, const avl_t *src);
+void interval_visit(const avl_t *node, int lo, int hi, const avl_t **out,
+		size_t size, size_t *found);
+int interval_build(const int *starts, const int *ends, size_t size,
+		avl_t *parent, avl_t **link);
+void avl_split(avl_t *root, int key, avl_t **lo, avl_t **hi);
+avl_t *avl_join(avl_t *lo, avl_t *pivot, avl_t *hi);
+avl_t *avl_join_side(avl_t *tall, avl_t *pivot, avl_t *small, int right);
+avl_t *avl_pop_max(avl_t **tree);
+avl_t *avl_remove_range(avl_t *root, int lo, int hi);
+int avl_set_heights(avl_t *tree);
+avl_t *avl_finger_insert(avl_t **tree, avl_t *finger, int value);
+void avl_retrace(avl_t **tree, avl_t *node, int (*update)(avl_t *));
+avl_t *avl_rotate(avl_t *node, int left, int (*update)(avl_t *));
+int avl_update_height(avl_t *node);
+int avl_height(const avl_t *node);
 avl_t *array_to_avl(int *array, size_t size);
+avl_t *array_to_avl_bulk(int *array, size_t size);
+size_t sorted_index_of(const int *sorted, size_t count, int value);
 avl_t *avl_remove(avl_t *root, int value);
+void avl_unlink(avl_t **tree, avl_t *node, void (*copy)(avl_t *, const avl_t *),
+		int (*update)(avl_t *));
 avl_t *sorted_array_to_avl(int *array, size_t size);
+avl_t *sorted_array_to_avl_block(const int *array, size_t size);
+void avl_block_fill(avl_block_task_t *task);
+void *avl_block_task(void *arg);
 int binary_tree_is_heap(const binary_tree_t *tree);
 heap_t *heap_insert(heap_t **root, int value);
 heap_t *array_to_heap(int *array, size_t size);
+void heap_handle_init(heap_handle_t *heap, heap_t *root);
+heap_t *heap_handle_insert(heap_handle_t *heap, int value);
+int heap_handle_extract(heap_handle_t *heap);
+heap_t *heap_node_at(heap_t *root, size_t index);
+size_t heap_size(const heap_t *root);
 int heap_extract(heap_t **root);
 int *heap_to_sorted_array(heap_t *heap, size_t *size);
+
+/* Lowest common ancestor index */
+lca_index_t *lca_index_create(const binary_tree_t *root);
+void lca_index_delete(lca_index_t *index);
+binary_tree_t *lca_index_query(const lca_index_t *index,
+		const binary_tree_t *first, const binary_tree_t *second);
+void lca_euler_tour(const binary_tree_t *root, const binary_tree_t **euler,
+		size_t *depth);
+void lca_hash_insert(lca_index_t *index);
+void lca_sparse_build(lca_index_t *index);
+size_t lca_hash(const binary_tree_t *node, size_t mask);
+int lca_index_find(const lca_index_t *index, const binary_tree_t *node,
+		size_t *first);
+
+/* Binary lifting ancestor table */
+lift_table_t *lift_table_create(const binary_tree_t *root);
+void lift_table_delete(lift_table_t *table);
+int lift_table_append(lift_table_t *table, const binary_tree_t *leaf);
+binary_tree_t *lift_kth_ancestor(const lift_table_t *table,
+		const binary_tree_t *node, size_t k);
+binary_tree_t *lift_ancestor(const lift_table_t *table,
+		const binary_tree_t *first, const binary_tree_t *second);
+size_t lift_distance(const lift_table_t *table,
+		const binary_tree_t *first, const binary_tree_t *second);
+int lift_is_ancestor(const lift_table_t *table, const binary_tree_t *u,
+		const binary_tree_t *v);
+size_t lift_index_of(const lift_table_t *table, const binary_tree_t *node);
+size_t lift_kth_index(const lift_table_t *table, size_t i, size_t k);
+size_t lift_lca_index(const lift_table_t *table, size_t a, size_t b);
+size_t lift_distance_index(const lift_table_t *table, size_t a, size_t b);
+int lift_is_ancestor_index(const lift_table_t *table, size_t u, size_t v);
+size_t lift_preorder(const binary_tree_t *root, const binary_tree_t **nodes,
+		size_t *depth);
+void lift_slot_insert(lift_table_t *table, size_t i);
+void lift_fill_row(lift_table_t *table, size_t i);
+int lift_rehash(lift_table_t *table);
+int lift_reserve(lift_table_t *table);
+int lift_relevel(lift_table_t *table);
+
+/* Offline batched ancestor queries */
+int binary_trees_ancestor_batch(const binary_tree_t *root,
+		const lca_query_t *queries, size_t count, binary_tree_t **out);
+size_t lca_batch_number(const binary_tree_t *root,
+		const binary_tree_t **nodes, size_t *up);
+int lca_batch_alloc(lca_batch_t *batch, size_t n, size_t count);
+void lca_batch_free(lca_batch_t *batch);
+void lca_batch_bucket(lca_batch_t *batch, const lca_query_t *queries,
+		size_t count);
+size_t lca_batch_find(size_t *set, size_t i);
+void lca_batch_union(lca_batch_t *batch, size_t i);
+void lca_batch_resolve(lca_batch_t *batch, binary_tree_t **out);
 #endif /* BINARY_TREES_H */
 